@@ -0,0 +1,85 @@
+//  MSSPCoreTests.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "MSSPCoreTests.h"
+
+#pragma mark - Types
+
+/**
+ *  A suite of tests.
+ */
+typedef struct
+{
+    /**
+     *  The name of the suite.
+     */
+    const char  *name;
+    
+    /**
+     *  The function which runs the tests of the suite.
+     */
+    void        (*run)(void);
+} MSSPTestsSuite;
+
+#pragma mark - Global variables
+
+static size_t   g_failuresCount;
+
+#pragma mark - Functions
+
+void MSSPTestsReportFailure(const char *file, int line, const char *condition)
+{
+    fprintf(stderr, "%s:%d: failed: %s\n", file, line, condition);
+    g_failuresCount++;
+}
+
+#pragma mark - Main
+
+int main(void)
+{
+    static const MSSPTestsSuite suites[] =
+    {
+        {"curves", MSSPCurvesTests},
+        {"pan_tracker", MSSPPanTrackerTests},
+        {"quality_governor", MSSPQualityGovernorTests},
+        {"stall_monitor", MSSPStallMonitorTests},
+    };
+    size_t  failuresCount;
+    size_t  i;
+    
+    for (i = 0; i < sizeof(suites) / sizeof(suites[0]); i++)
+    {
+        failuresCount = g_failuresCount;
+        suites[i].run();
+        printf("%-20s %s\n", suites[i].name, (g_failuresCount == failuresCount ? "passed" : "failed"));
+    }
+    
+    return (g_failuresCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,79 @@
+//  MSSPCoreTests.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_CORE_TESTS_H
+#define MSSP_CORE_TESTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  Check a condition. If it is false, the failure is reported with its location and the test goes on.
+ */
+#define MSSP_TEST_ASSERT(condition)     ((condition) ? (void)0 : MSSPTestsReportFailure(__FILE__, __LINE__, #condition))
+
+#pragma mark - Functions
+
+/**
+ *  Report a failed condition.
+ *
+ *  @param file      The file of the condition.
+ *  @param line      The line of the condition.
+ *  @param condition The text of the condition.
+ */
+void    MSSPTestsReportFailure(const char *file, int line, const char *condition);
+
+#pragma mark - Suites
+
+/**
+ *  Run the tests of the curves.
+ */
+void    MSSPCurvesTests(void);
+
+/**
+ *  Run the tests of the pan tracker.
+ */
+void    MSSPPanTrackerTests(void);
+
+/**
+ *  Run the tests of the quality governor.
+ */
+void    MSSPQualityGovernorTests(void);
+
+/**
+ *  Run the tests of the stall monitor.
+ */
+void    MSSPStallMonitorTests(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
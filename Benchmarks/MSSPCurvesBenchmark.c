@@ -0,0 +1,225 @@
+//  MSSPCurvesBenchmark.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "MSSPCurves.h"
+
+#pragma mark - Macros
+
+#define MSSP_BENCHMARK_INPUTS_COUNT     4096
+#define MSSP_BENCHMARK_ITERATIONS       2000
+#define MSSP_BENCHMARK_ERROR_SAMPLES    1000000
+#define MSSP_BENCHMARK_DIMENSION        280.0
+
+#pragma mark - Global variables
+
+static double           g_inputs[MSSP_BENCHMARK_INPUTS_COUNT];
+static volatile double  g_sink;
+
+#pragma mark - Private functions
+
+/**
+ *  Returns the current time, in nanoseconds.
+ *
+ *  @return The time.
+ */
+static double MSSPBenchmarkNow(void)
+{
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    
+    return ((double)time.tv_sec * 1e9 + (double)time.tv_nsec);
+}
+
+/**
+ *  Measure the duration of an evaluation of a curve.
+ *
+ *  @param evaluate The evaluation function.
+ *  @param curve    The curve.
+ *
+ *  @return The duration of an evaluation, in nanoseconds.
+ */
+static double MSSPBenchmarkCurve(double (*evaluate)(MSSPCurve, double), MSSPCurve curve)
+{
+    double  begin;
+    size_t  i;
+    size_t  j;
+    double  sum;
+    
+    sum = 0;
+    begin = MSSPBenchmarkNow();
+    
+    for (i = 0; i < MSSP_BENCHMARK_ITERATIONS; i++)
+        for (j = 0; j < MSSP_BENCHMARK_INPUTS_COUNT; j++)
+            sum += evaluate(curve, g_inputs[j]);
+    
+    g_sink = sum;
+    
+    return ((MSSPBenchmarkNow() - begin) / ((double)MSSP_BENCHMARK_ITERATIONS * MSSP_BENCHMARK_INPUTS_COUNT));
+}
+
+/**
+ *  Measure the duration of an evaluation of the rubber band.
+ *
+ *  @param evaluate The evaluation function.
+ *
+ *  @return The duration of an evaluation, in nanoseconds.
+ */
+static double MSSPBenchmarkRubberBand(double (*evaluate)(double, double))
+{
+    double  begin;
+    size_t  i;
+    size_t  j;
+    double  sum;
+    
+    sum = 0;
+    begin = MSSPBenchmarkNow();
+    
+    for (i = 0; i < MSSP_BENCHMARK_ITERATIONS; i++)
+        for (j = 0; j < MSSP_BENCHMARK_INPUTS_COUNT; j++)
+            sum += evaluate(g_inputs[j] * MSSP_BENCHMARK_DIMENSION, MSSP_BENCHMARK_DIMENSION);
+    
+    g_sink = sum;
+    
+    return ((MSSPBenchmarkNow() - begin) / ((double)MSSP_BENCHMARK_ITERATIONS * MSSP_BENCHMARK_INPUTS_COUNT));
+}
+
+/**
+ *  Returns the maximum difference between the interpolated and the exact values of a curve.
+ *
+ *  @param curve The curve.
+ *
+ *  @return The maximum error.
+ */
+static double MSSPBenchmarkCurveError(MSSPCurve curve)
+{
+    double  error;
+    size_t  i;
+    double  maximumError;
+    double  progress;
+    
+    maximumError = 0;
+    
+    for (i = 0; i <= MSSP_BENCHMARK_ERROR_SAMPLES; i++)
+    {
+        progress = (double)i / MSSP_BENCHMARK_ERROR_SAMPLES;
+        error = MSSPCurveEvaluate(curve, progress) - MSSPCurveEvaluateDirect(curve, progress);
+        
+        if (error < 0)
+            error = -error;
+        
+        if (error > maximumError)
+            maximumError = error;
+    }
+    
+    return (maximumError);
+}
+
+/**
+ *  Returns the maximum difference between the interpolated and the exact values of the rubber band, as a fraction of the dimension.
+ *
+ *  @return The maximum error.
+ */
+static double MSSPBenchmarkRubberBandError(void)
+{
+    double  error;
+    size_t  i;
+    double  maximumError;
+    double  overscroll;
+    
+    maximumError = 0;
+    
+    for (i = 0; i <= MSSP_BENCHMARK_ERROR_SAMPLES; i++)
+    {
+        overscroll = (double)i / MSSP_BENCHMARK_ERROR_SAMPLES * (MSSP_CURVES_RUBBER_BAND_RANGE + 1) * MSSP_BENCHMARK_DIMENSION;
+        error = MSSPCurvesRubberBand(-overscroll, MSSP_BENCHMARK_DIMENSION) - MSSPCurvesRubberBandDirect(-overscroll, MSSP_BENCHMARK_DIMENSION);
+        
+        if (error < 0)
+            error = -error;
+        
+        if (error > maximumError)
+            maximumError = error;
+    }
+    
+    return (maximumError / MSSP_BENCHMARK_DIMENSION);
+}
+
+#pragma mark - Main
+
+int main(void)
+{
+    static const struct
+    {
+        const char  *name;
+        MSSPCurve   curve;
+    } curves[] =
+    {
+        {"linear", MSSPCurveLinear},
+        {"ease_in", MSSPCurveEaseIn},
+        {"ease_out", MSSPCurveEaseOut},
+        {"ease_in_out", MSSPCurveEaseInOut},
+        {"decelerate", MSSPCurveDecelerate},
+    };
+    double  error;
+    size_t  i;
+    int     status;
+    
+    srand(42);
+    for (i = 0; i < MSSP_BENCHMARK_INPUTS_COUNT; i++)
+        g_inputs[i] = (double)rand() / RAND_MAX;
+    
+    status = EXIT_SUCCESS;
+    printf("%-12s %12s %12s %14s\n", "curve", "table (ns)", "direct (ns)", "max error");
+    
+    for (i = 0; i < sizeof(curves) / sizeof(curves[0]); i++)
+    {
+        error = MSSPBenchmarkCurveError(curves[i].curve);
+        printf("%-12s %12.2f %12.2f %14.3e\n", curves[i].name, MSSPBenchmarkCurve(MSSPCurveEvaluate, curves[i].curve),
+               MSSPBenchmarkCurve(MSSPCurveEvaluateDirect, curves[i].curve), error);
+        
+        if (error > MSSP_CURVES_MAXIMUM_ERROR)
+            status = EXIT_FAILURE;
+    }
+    
+    error = MSSPBenchmarkRubberBandError();
+    printf("%-12s %12.2f %12.2f %14.3e\n", "rubber_band", MSSPBenchmarkRubberBand(MSSPCurvesRubberBand),
+           MSSPBenchmarkRubberBand(MSSPCurvesRubberBandDirect), error);
+    
+    if (error > MSSP_CURVES_MAXIMUM_ERROR)
+        status = EXIT_FAILURE;
+    
+    if (status != EXIT_SUCCESS)
+        fprintf(stderr, "The interpolation error exceeds MSSP_CURVES_MAXIMUM_ERROR (%g).\n", MSSP_CURVES_MAXIMUM_ERROR);
+    
+    return (status);
+}
@@ -0,0 +1,164 @@
+//  MSSPCurvesTests.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <math.h>
+#include <stddef.h>
+
+#include "MSSPCoreTests.h"
+#include "MSSPCurves.h"
+
+#pragma mark - Macros
+
+#define MSSP_TESTS_SAMPLES          100000
+#define MSSP_TESTS_DIMENSION        280.0
+#define MSSP_TESTS_TOLERANCE        1e-12
+
+#pragma mark - Global variables
+
+static const MSSPCurve  g_curves[] = {MSSPCurveLinear, MSSPCurveEaseIn, MSSPCurveEaseOut, MSSPCurveEaseInOut, MSSPCurveDecelerate};
+
+#pragma mark - Private functions
+
+/**
+ *  Evaluate the analytic form of a curve, written independently from the library.
+ *
+ *  @param curve    The curve.
+ *  @param progress The progress of the time, between 0 and 1.
+ *
+ *  @return The progress of the value.
+ */
+static double MSSPTestsAnalyticCurve(MSSPCurve curve, double progress)
+{
+    switch (curve)
+    {
+        case MSSPCurveEaseIn:
+            return (pow(progress, 3));
+        case MSSPCurveEaseOut:
+            return (1 - pow(1 - progress, 3));
+        case MSSPCurveEaseInOut:
+            return (progress < 0.5 ? 4 * pow(progress, 3) : 1 - 4 * pow(1 - progress, 3));
+        case MSSPCurveDecelerate:
+            return (1 - pow(1 - progress, 5));
+        default:
+            return (progress);
+    }
+}
+
+/**
+ *  Evaluate the analytic form of the rubber band, written independently from the library.
+ *
+ *  @param overscroll The distance dragged beyond the limit.
+ *  @param dimension  The dimension of the dragged area.
+ *
+ *  @return The displayed distance.
+ */
+static double MSSPTestsAnalyticRubberBand(double overscroll, double dimension)
+{
+    double  ratio;
+    
+    ratio = fabs(overscroll) / dimension;
+    
+    return (copysign(MSSP_CURVES_RUBBER_BAND_COEFFICIENT * ratio / (1 + MSSP_CURVES_RUBBER_BAND_COEFFICIENT * ratio) * dimension, overscroll));
+}
+
+#pragma mark - Tests
+
+/**
+ *  The interpolated curves never differ from the analytic ones by more than the maximum error, and the direct evaluations are exact.
+ */
+static void MSSPTestsCurvesError(void)
+{
+    size_t  i;
+    size_t  j;
+    double  maximumError;
+    double  progress;
+    
+    for (i = 0; i < sizeof(g_curves) / sizeof(g_curves[0]); i++)
+    {
+        maximumError = 0;
+        
+        for (j = 0; j <= MSSP_TESTS_SAMPLES; j++)
+        {
+            progress = (double)j / MSSP_TESTS_SAMPLES;
+            maximumError = fmax(maximumError, fabs(MSSPCurveEvaluate(g_curves[i], progress) - MSSPTestsAnalyticCurve(g_curves[i], progress)));
+            MSSP_TEST_ASSERT(fabs(MSSPCurveEvaluateDirect(g_curves[i], progress) - MSSPTestsAnalyticCurve(g_curves[i], progress)) < MSSP_TESTS_TOLERANCE);
+        }
+        
+        MSSP_TEST_ASSERT(maximumError <= MSSP_CURVES_MAXIMUM_ERROR);
+    }
+}
+
+/**
+ *  Every curve starts exactly at 0 and ends exactly at 1, and the progress is clamped outside.
+ */
+static void MSSPTestsCurvesEndpoints(void)
+{
+    size_t  i;
+    
+    for (i = 0; i < sizeof(g_curves) / sizeof(g_curves[0]); i++)
+    {
+        MSSP_TEST_ASSERT(MSSPCurveEvaluate(g_curves[i], 0) == 0);
+        MSSP_TEST_ASSERT(MSSPCurveEvaluate(g_curves[i], 1) == 1);
+        MSSP_TEST_ASSERT(MSSPCurveEvaluateDirect(g_curves[i], 0) == 0);
+        MSSP_TEST_ASSERT(MSSPCurveEvaluateDirect(g_curves[i], 1) == 1);
+        MSSP_TEST_ASSERT(MSSPCurveEvaluate(g_curves[i], -0.5) == 0);
+        MSSP_TEST_ASSERT(MSSPCurveEvaluate(g_curves[i], 1.5) == 1);
+    }
+}
+
+/**
+ *  The interpolated rubber band never differs from the analytic one by more than the maximum error times the dimension, in both directions and beyond its table.
+ */
+static void MSSPTestsRubberBandError(void)
+{
+    size_t  i;
+    double  maximumError;
+    double  overscroll;
+    
+    maximumError = 0;
+    
+    for (i = 0; i <= MSSP_TESTS_SAMPLES; i++)
+    {
+        overscroll = (double)i / MSSP_TESTS_SAMPLES * (MSSP_CURVES_RUBBER_BAND_RANGE + 1) * MSSP_TESTS_DIMENSION;
+        maximumError = fmax(maximumError, fabs(MSSPCurvesRubberBand(overscroll, MSSP_TESTS_DIMENSION) - MSSPTestsAnalyticRubberBand(overscroll, MSSP_TESTS_DIMENSION)));
+        maximumError = fmax(maximumError, fabs(MSSPCurvesRubberBand(-overscroll, MSSP_TESTS_DIMENSION) - MSSPTestsAnalyticRubberBand(-overscroll, MSSP_TESTS_DIMENSION)));
+    }
+    
+    MSSP_TEST_ASSERT(maximumError <= MSSP_CURVES_MAXIMUM_ERROR * MSSP_TESTS_DIMENSION);
+    MSSP_TEST_ASSERT(MSSPCurvesRubberBand(0, MSSP_TESTS_DIMENSION) == 0);
+    MSSP_TEST_ASSERT(MSSPCurvesRubberBand(-1e6, MSSP_TESTS_DIMENSION) > -MSSP_TESTS_DIMENSION);
+    MSSP_TEST_ASSERT(MSSPCurvesRubberBand(1e6, MSSP_TESTS_DIMENSION) < MSSP_TESTS_DIMENSION);
+}
+
+#pragma mark - Suite
+
+void MSSPCurvesTests(void)
+{
+    MSSPTestsCurvesError();
+    MSSPTestsCurvesEndpoints();
+    MSSPTestsRubberBandError();
+}
@@ -0,0 +1,208 @@
+//  MSSPPanTrackerTests.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+
+#include "MSSPCoreTests.h"
+#include "MSSPPanTracker.h"
+
+#pragma mark - Macros
+
+#define MSSP_TESTS_PANEL_WIDTH      250.0
+#define MSSP_TESTS_WINDOW           0x10
+#define MSSP_TESTS_OTHER_WINDOW     0x20
+#define MSSP_TESTS_TOUCH            0x100
+#define MSSP_TESTS_OTHER_TOUCH      0x200
+
+#pragma mark - Helpers
+
+/**
+ *  Initialize an engine with a left and a right panel.
+ *
+ *  @param engine The engine.
+ */
+static void MSSPTestsInitEngine(MSSPPanelEngine *engine)
+{
+    memset(engine, 0, sizeof(*engine));
+    engine->leftPanelWidth = MSSP_TESTS_PANEL_WIDTH;
+    engine->rightPanelWidth = MSSP_TESTS_PANEL_WIDTH;
+    engine->hasLeftPanel = 1;
+    engine->hasRightPanel = 1;
+}
+
+/**
+ *  Replay a pan which begins at a position, moves to another one and ends.
+ *
+ *  @param engine         The engine.
+ *  @param beginOriginX   The position of the center view when the pan begins, in points.
+ *  @param beginDirection The displayed side when the pan begins.
+ *  @param endOriginX     The position of the center view when the pan ends, in points.
+ *  @param endDirection   The displayed side when the pan ends.
+ *  @param ending         The way the pan ends.
+ *
+ *  @return The side returned by the tracker.
+ */
+static int MSSPTestsReplayPan(const MSSPPanelEngine *engine, double beginOriginX, int beginDirection, double endOriginX, int endDirection, MSSPPanEnding ending)
+{
+    MSSPPanTracker  tracker;
+    int             side;
+    
+    MSSPPanTrackerInit(&tracker);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+    MSSPPanTrackerBegin(&tracker, engine, MSSP_TESTS_WINDOW, beginOriginX, beginDirection);
+    MSSP_TEST_ASSERT(tracker.tracking == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, (endOriginX - beginOriginX) / 2) == (endOriginX - beginOriginX) / 2);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, endOriginX - beginOriginX) == (endOriginX - beginOriginX) / 2);
+    
+    side = MSSPPanTrackerEnd(&tracker, engine, endOriginX, endDirection, ending);
+    MSSP_TEST_ASSERT(tracker.touch == 0);
+    MSSP_TEST_ASSERT(tracker.tracking == 0);
+    
+    return (side);
+}
+
+#pragma mark - Tests
+
+/**
+ *  A completed pan settles on the nearest side, a cancelled or failed one goes back to the side displayed when it began.
+ */
+static void MSSPTestsEndings(void)
+{
+    MSSPPanelEngine engine;
+    
+    MSSPTestsInitEngine(&engine);
+    
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, 0, 0, 200, 1, MSSPPanEndingCompleted) == 1);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, 0, 0, 200, 1, MSSPPanEndingCancelled) == 0);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, 0, 0, 200, 1, MSSPPanEndingFailed) == 0);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, 0, 0, 50, 1, MSSPPanEndingCompleted) == 0);
+    
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, MSSP_TESTS_PANEL_WIDTH, 1, 20, 1, MSSPPanEndingCompleted) == 0);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, MSSP_TESTS_PANEL_WIDTH, 1, 20, 1, MSSPPanEndingCancelled) == 1);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, MSSP_TESTS_PANEL_WIDTH, 1, 20, 1, MSSPPanEndingFailed) == 1);
+    
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, -MSSP_TESTS_PANEL_WIDTH, -1, -200, -1, MSSPPanEndingCompleted) == -1);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, -MSSP_TESTS_PANEL_WIDTH, -1, -200, 1, MSSPPanEndingCancelled) == -1);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, -MSSP_TESTS_PANEL_WIDTH, -1, 200, 1, MSSPPanEndingCompleted) == 1);
+}
+
+/**
+ *  A pan never settles on a side without panel, even if it began there.
+ */
+static void MSSPTestsMissingPanel(void)
+{
+    MSSPPanelEngine engine;
+    
+    MSSPTestsInitEngine(&engine);
+    engine.hasLeftPanel = 0;
+    
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, 0, 0, 200, 1, MSSPPanEndingCompleted) == 0);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, MSSP_TESTS_PANEL_WIDTH, 1, 200, 1, MSSPPanEndingCancelled) == 0);
+    MSSP_TEST_ASSERT(MSSPTestsReplayPan(&engine, -MSSP_TESTS_PANEL_WIDTH, -1, -200, -1, MSSPPanEndingCompleted) == -1);
+}
+
+/**
+ *  A second touch can neither take the ownership of a claimed pan nor of a running one, and can own the next pan.
+ */
+static void MSSPTestsSecondTouch(void)
+{
+    MSSPPanelEngine engine;
+    MSSPPanTracker  tracker;
+    
+    MSSPTestsInitEngine(&engine);
+    MSSPPanTrackerInit(&tracker);
+    
+    MSSP_TEST_ASSERT(MSSPPanTrackerCanClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+    MSSP_TEST_ASSERT(tracker.touch == 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerCanClaimTouch(&tracker, MSSP_TESTS_OTHER_TOUCH) == 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_OTHER_TOUCH) == 0);
+    MSSP_TEST_ASSERT(tracker.touch == MSSP_TESTS_TOUCH);
+    
+    MSSPPanTrackerBegin(&tracker, &engine, MSSP_TESTS_WINDOW, 0, 0);
+    MSSPPanTrackerReleaseTouch(&tracker);
+    MSSP_TEST_ASSERT(tracker.touch == MSSP_TESTS_TOUCH);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_OTHER_TOUCH) == 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, 180) == 180);
+    MSSP_TEST_ASSERT(MSSPPanTrackerEnd(&tracker, &engine, 180, 1, MSSPPanEndingCompleted) == 1);
+    
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_OTHER_TOUCH) == 1);
+    MSSPPanTrackerReleaseTouch(&tracker);
+    MSSP_TEST_ASSERT(tracker.touch == 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+}
+
+/**
+ *  A pan moved to another window can not go on, and the center view goes back to the side displayed when it began.
+ */
+static void MSSPTestsWindowChange(void)
+{
+    MSSPPanelEngine engine;
+    MSSPPanTracker  tracker;
+    
+    MSSPTestsInitEngine(&engine);
+    MSSPPanTrackerInit(&tracker);
+    
+    MSSP_TEST_ASSERT(MSSPPanTrackerIsInWindow(&tracker, MSSP_TESTS_OTHER_WINDOW) == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerClaimTouch(&tracker, MSSP_TESTS_TOUCH) == 1);
+    MSSPPanTrackerBegin(&tracker, &engine, MSSP_TESTS_WINDOW, MSSP_TESTS_PANEL_WIDTH, 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, -200) == -200);
+    MSSP_TEST_ASSERT(MSSPPanTrackerIsInWindow(&tracker, MSSP_TESTS_WINDOW) == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerIsInWindow(&tracker, MSSP_TESTS_OTHER_WINDOW) == 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerEnd(&tracker, &engine, 50, 1, MSSPPanEndingCancelled) == 1);
+    MSSP_TEST_ASSERT(MSSPPanTrackerIsInWindow(&tracker, MSSP_TESTS_OTHER_WINDOW) == 1);
+}
+
+/**
+ *  A rebased translation is not applied again by the next move.
+ */
+static void MSSPTestsRebase(void)
+{
+    MSSPPanelEngine engine;
+    MSSPPanTracker  tracker;
+    
+    MSSPTestsInitEngine(&engine);
+    MSSPPanTrackerInit(&tracker);
+    
+    MSSPPanTrackerBegin(&tracker, &engine, MSSP_TESTS_WINDOW, 0, 0);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, 40) == 40);
+    MSSPPanTrackerRebase(&tracker, 100);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, 110) == 10);
+    MSSP_TEST_ASSERT(MSSPPanTrackerMove(&tracker, 90) == -20);
+}
+
+#pragma mark - Suite
+
+void MSSPPanTrackerTests(void)
+{
+    MSSPTestsEndings();
+    MSSPTestsMissingPanel();
+    MSSPTestsSecondTouch();
+    MSSPTestsWindowChange();
+    MSSPTestsRebase();
+}
@@ -0,0 +1,298 @@
+//  MSSPPanelEngineBenchmark.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "MSSPPanelEngine.h"
+
+#pragma mark - Macros
+
+#define MSSP_BENCHMARK_SAMPLES_COUNT        4096
+#define MSSP_BENCHMARK_OPERATIONS           (1 << 21)
+#define MSSP_BENCHMARK_MAXIMUM_CONTROLLERS  100
+#define MSSP_BENCHMARK_FRAME_BUDGET         (1e9 / 60)
+#define MSSP_BENCHMARK_LOCK_ANGLE           30.0
+
+#pragma mark - Types
+
+/**
+ *  A pan sample given to the operations.
+ */
+typedef struct
+{
+    double  x;
+    double  y;
+    double  originX;
+    double  progress;
+    int     direction;
+} MSSPBenchmarkSample;
+
+/**
+ *  An operation measured for one controller.
+ *
+ *  @param engine The engine of the controller.
+ *  @param sample The pan sample.
+ *
+ *  @return A value which depends on the result, to prevent the compiler from dropping the operation.
+ */
+typedef double (*MSSPBenchmarkOperation)(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample);
+
+#pragma mark - Global variables
+
+static MSSPPanelEngine      g_engines[MSSP_BENCHMARK_MAXIMUM_CONTROLLERS];
+static MSSPBenchmarkSample  g_samples[MSSP_BENCHMARK_SAMPLES_COUNT];
+static volatile double      g_sink;
+
+#pragma mark - Private functions
+
+/**
+ *  Returns the current time, in nanoseconds.
+ *
+ *  @return The time.
+ */
+static double MSSPBenchmarkNow(void)
+{
+    struct timespec time;
+    
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    
+    return ((double)time.tv_sec * 1e9 + (double)time.tv_nsec);
+}
+
+/**
+ *  Returns a random number.
+ *
+ *  @param minimum The minimum value.
+ *  @param maximum The maximum value.
+ *
+ *  @return The number.
+ */
+static double MSSPBenchmarkRandom(double minimum, double maximum)
+{
+    return (minimum + (maximum - minimum) * rand() / RAND_MAX);
+}
+
+/**
+ *  Fill the engines with various settings and the samples with a noisy pan.
+ */
+static void MSSPBenchmarkInit(void)
+{
+    static const MSSPRevealStyle    styles[] = {MSSPRevealStyleRevealUnder, MSSPRevealStyleSlideOver, MSSPRevealStyleScaleDown, MSSPRevealStyleRotate3D};
+    MSSPPanelEngine                 *engine;
+    size_t                          i;
+    
+    srand(42);
+    
+    for (i = 0; i < MSSP_BENCHMARK_MAXIMUM_CONTROLLERS; i++)
+    {
+        engine = &g_engines[i];
+        engine->leftPanelWidth = 240 + 20 * (i % 5);
+        engine->rightPanelWidth = 280 - 20 * (i % 3);
+        engine->hasLeftPanel = 1;
+        engine->hasRightPanel = (i % 4 != 3);
+        engine->rubberBandEnabled = (int)(i % 2);
+        engine->switchHysteresis = (i % 3 == 0 ? 20 : 0);
+        engine->centerStatusBarColor = (MSSPColorComponents){1, 1, 1, 0};
+        engine->leftStatusBarColor = (MSSPColorComponents){0.2, 0.3, 0.4, 1};
+        engine->rightStatusBarColor = (MSSPColorComponents){0.8, 0.1, 0.1, 1};
+        engine->leftStatusBarBlended = 1;
+        engine->rightStatusBarBlended = (int)(i % 2);
+        engine->revealStyleEvaluator = MSSPRevealStyleGetEvaluator(styles[i % (sizeof(styles) / sizeof(styles[0]))]);
+    }
+    
+    for (i = 0; i < MSSP_BENCHMARK_SAMPLES_COUNT; i++)
+    {
+        g_samples[i].x = MSSPBenchmarkRandom(-40, 40);
+        g_samples[i].y = MSSPBenchmarkRandom(-40, 40);
+        g_samples[i].originX = MSSPBenchmarkRandom(-400, 400);
+        g_samples[i].progress = MSSPBenchmarkRandom(0, 1);
+        g_samples[i].direction = (g_samples[i].originX > 0 ? 1 : (g_samples[i].originX < 0 ? -1 : 0));
+    }
+}
+
+#pragma mark - Operations
+
+/**
+ *  Classify a pan sample.
+ */
+static double MSSPBenchmarkClassify(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    (void)engine;
+    
+    return (MSSPPanelEngineIsPanHorizontal(sample->x, sample->y, MSSP_BENCHMARK_LOCK_ANGLE));
+}
+
+/**
+ *  Clamp a pan step.
+ */
+static double MSSPBenchmarkClamp(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    MSSPPanelClamp  clamp;
+    
+    MSSPPanelEngineClamp(engine, sample->originX + sample->x, sample->direction, &clamp);
+    
+    return (clamp.originX + clamp.overscrollTranslation + clamp.hysteresisTranslation);
+}
+
+/**
+ *  Decide where a pan settles.
+ */
+static double MSSPBenchmarkSnap(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    return (MSSPPanelEngineSnap(engine, sample->originX, sample->direction));
+}
+
+/**
+ *  Blend the status bar color.
+ */
+static double MSSPBenchmarkStatusBar(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    return (MSSPPanelEngineStatusBarColor(engine, sample->originX, sample->direction).alpha);
+}
+
+/**
+ *  Compute a step of an animation toward the snapped side.
+ */
+static double MSSPBenchmarkAnimationStep(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    return (MSSPPanelEngineAnimationOriginX(MSSPCurveEaseInOut, sample->originX, sample->direction * engine->leftPanelWidth, sample->progress));
+}
+
+/**
+ *  Compute everything which follows the position of the center view.
+ */
+static double MSSPBenchmarkProgress(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    MSSPPanelProgress   progress;
+    
+    MSSPPanelEngineEvaluateProgress(engine, sample->originX, sample->direction, &progress);
+    
+    return (progress.fraction + progress.reveal.center.scale + progress.statusBarColor.red);
+}
+
+/**
+ *  Run a whole pan frame: classification, clamp and progress fan-out.
+ */
+static double MSSPBenchmarkPanFrame(const MSSPPanelEngine *engine, const MSSPBenchmarkSample *sample)
+{
+    MSSPPanelClamp      clamp;
+    MSSPPanelProgress   progress;
+    
+    if (!MSSPPanelEngineIsPanHorizontal(sample->x, sample->y, MSSP_BENCHMARK_LOCK_ANGLE))
+        return (0);
+    
+    MSSPPanelEngineClamp(engine, sample->originX + sample->x, sample->direction, &clamp);
+    MSSPPanelEngineEvaluateProgress(engine, clamp.originX, sample->direction, &progress);
+    
+    return (progress.fraction + progress.statusBarColor.alpha);
+}
+
+#pragma mark - Measure
+
+/**
+ *  Measure an operation run for several controllers at each frame.
+ *
+ *  @param operation        The operation.
+ *  @param controllersCount The number of controllers.
+ *  @param framesCount      Filled with the number of frames run.
+ *
+ *  @return The duration of a frame, in nanoseconds.
+ */
+static double MSSPBenchmarkMeasure(MSSPBenchmarkOperation operation, size_t controllersCount, size_t *framesCount)
+{
+    double  begin;
+    size_t  controller;
+    size_t  frame;
+    size_t  sample;
+    double  sum;
+    
+    *framesCount = MSSP_BENCHMARK_OPERATIONS / controllersCount;
+    sample = 0;
+    sum = 0;
+    begin = MSSPBenchmarkNow();
+    
+    for (frame = 0; frame < *framesCount; frame++)
+    {
+        for (controller = 0; controller < controllersCount; controller++)
+        {
+            sum += operation(&g_engines[controller], &g_samples[sample]);
+            sample = (sample + 1) % MSSP_BENCHMARK_SAMPLES_COUNT;
+        }
+    }
+    
+    g_sink = sum;
+    
+    return ((MSSPBenchmarkNow() - begin) / (double)*framesCount);
+}
+
+#pragma mark - Main
+
+int main(void)
+{
+    static const struct
+    {
+        const char              *name;
+        MSSPBenchmarkOperation  operation;
+    } operations[] =
+    {
+        {"classify", MSSPBenchmarkClassify},
+        {"clamp", MSSPBenchmarkClamp},
+        {"snap", MSSPBenchmarkSnap},
+        {"status_bar_blend", MSSPBenchmarkStatusBar},
+        {"animation_step", MSSPBenchmarkAnimationStep},
+        {"progress_fan_out", MSSPBenchmarkProgress},
+        {"pan_frame", MSSPBenchmarkPanFrame},
+    };
+    static const size_t controllersCounts[] = {1, 10, 100};
+    size_t              framesCount;
+    double              frameDuration;
+    size_t              i;
+    size_t              j;
+    
+    MSSPBenchmarkInit();
+    
+    printf("{\n  \"suite\": \"MSSPPanelEngine\",\n  \"frame_budget_ns\": %.0f,\n  \"results\": [\n", MSSP_BENCHMARK_FRAME_BUDGET);
+    
+    for (i = 0; i < sizeof(operations) / sizeof(operations[0]); i++)
+    {
+        for (j = 0; j < sizeof(controllersCounts) / sizeof(controllersCounts[0]); j++)
+        {
+            frameDuration = MSSPBenchmarkMeasure(operations[i].operation, controllersCounts[j], &framesCount);
+            printf("    {\"benchmark\": \"%s\", \"controllers\": %lu, \"frames\": %lu, \"ns_per_frame\": %.2f, \"ns_per_controller\": %.2f, \"frame_budget_percent\": %.5f}%s\n",
+                   operations[i].name, (unsigned long)controllersCounts[j], (unsigned long)framesCount, frameDuration, frameDuration / controllersCounts[j],
+                   frameDuration * 100 / MSSP_BENCHMARK_FRAME_BUDGET, (i + 1 == sizeof(operations) / sizeof(operations[0]) && j + 1 == sizeof(controllersCounts) / sizeof(controllersCounts[0]) ? "" : ","));
+        }
+    }
+    
+    printf("  ]\n}\n");
+    
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,207 @@
+//  MSSPQualityGovernorTests.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "MSSPCoreTests.h"
+#include "MSSPQualityGovernor.h"
+
+#pragma mark - Macros
+
+#define MSSP_TESTS_BUDGET_60HZ      (1.0 / 60)
+#define MSSP_TESTS_BUDGET_120HZ     (1.0 / 120)
+#define MSSP_TESTS_FRAME_MISSED     (3.0 / 60)
+#define MSSP_TESTS_FRAME_ON_TIME    (0.9 / 60)
+#define MSSP_TESTS_FRAME_FAST       (0.5 / 60)
+
+#pragma mark - Private functions
+
+/**
+ *  Record the same frame duration several times.
+ *
+ *  @param governor      The governor.
+ *  @param frameDuration The duration of each frame, in seconds.
+ *  @param count         The number of frames.
+ *
+ *  @return The level after the last frame.
+ */
+static MSSPQualityLevel MSSPTestsRecordFrames(MSSPQualityGovernor *governor, double frameDuration, size_t count)
+{
+    size_t  i;
+    
+    for (i = 0; i < count; i++)
+        MSSPQualityGovernorRecordFrame(governor, frameDuration);
+    
+    return (governor->level);
+}
+
+#pragma mark - Tests
+
+/**
+ *  Over budget frames degrade the level by one step per half window, down to the last level.
+ */
+static void MSSPTestsStepDown(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 1) == MSSPQualityLevelFull);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelSnapStatusBar);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 1) == MSSPQualityLevelSnapStatusBar);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2) == MSSPQualityLevelSnapshotCenter);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4) == MSSPQualityLevelSnapshotCenter);
+}
+
+/**
+ *  A single missed frame in half a window is tolerated, a quarter of missed frames is not.
+ */
+static void MSSPTestsStepDownThreshold(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    
+    MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_ON_TIME, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 1);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelFull);
+    
+    MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_ON_TIME, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 2);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelFull);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelFull);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelSnapStatusBar);
+}
+
+/**
+ *  Fast frames restore the level by one step per complete window, up to the full level.
+ */
+static void MSSPTestsStepUp(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 2);
+    MSSP_TEST_ASSERT(governor.level == MSSPQualityLevelSnapshotCenter);
+    
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE - 1) == MSSPQualityLevelSnapshotCenter);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, 1) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE - 1) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, 1) == MSSPQualityLevelSnapStatusBar);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE) == MSSPQualityLevelFull);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4) == MSSPQualityLevelFull);
+}
+
+/**
+ *  Frames which are on time but without headroom, or a missed frame in the window, don't restore the level: it doesn't oscillate around the budget.
+ */
+static void MSSPTestsHysteresis(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2);
+    MSSP_TEST_ASSERT(governor.level == MSSPQualityLevelSnapStatusBar);
+    
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_ON_TIME, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 8) == MSSPQualityLevelSnapStatusBar);
+    
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, 1) == MSSPQualityLevelSnapStatusBar);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE - 1) == MSSPQualityLevelSnapStatusBar);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, 1) == MSSPQualityLevelFull);
+}
+
+/**
+ *  In low power mode, the level is raised to the minimum level and never restored beyond it.
+ */
+static void MSSPTestsLowPower(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    
+    MSSP_TEST_ASSERT(MSSPQualityGovernorSetMinimumLevel(&governor, MSSPQualityLevelNoShadow) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_MISSED, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2) == MSSPQualityLevelSnapshotCenter);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4) == MSSPQualityLevelNoShadow);
+    
+    MSSP_TEST_ASSERT(MSSPQualityGovernorSetMinimumLevel(&governor, MSSPQualityLevelFull) == MSSPQualityLevelNoShadow);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_FRAME_FAST, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 2) == MSSPQualityLevelFull);
+}
+
+/**
+ *  When the refresh rate doubles, the frames which were on time at 60 Hz are missed.
+ */
+static void MSSPTestsFrameBudget(void)
+{
+    MSSPQualityGovernor governor;
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_60HZ);
+    
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_BUDGET_60HZ, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 1) == MSSPQualityLevelFull);
+    MSSPQualityGovernorSetFrameBudget(&governor, MSSP_TESTS_BUDGET_120HZ);
+    MSSP_TEST_ASSERT(governor.missedFramesCount == MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 - 1);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_BUDGET_60HZ, 1) == MSSPQualityLevelSnapStatusBar);
+}
+
+/**
+ *  Frames at the 60 Hz requested by a slide are on time on a 120 Hz screen when the budget follows the requested frame rate, and missed when it follows the refresh rate.
+ */
+static void MSSPTestsRequestedFrameRate(void)
+{
+    double              frameBudget;
+    MSSPQualityGovernor governor;
+    size_t              i;
+    double              timestamp;
+    
+    MSSP_TEST_ASSERT(MSSPQualityGovernorFrameBudgetOfFrame(0, MSSP_TESTS_BUDGET_60HZ, MSSP_TESTS_BUDGET_120HZ) == MSSP_TESTS_BUDGET_60HZ);
+    MSSP_TEST_ASSERT(MSSPQualityGovernorFrameBudgetOfFrame(1, 0, MSSP_TESTS_BUDGET_120HZ) == MSSP_TESTS_BUDGET_120HZ);
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_120HZ);
+    
+    for (i = 0, timestamp = 1; i < MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4; i++, timestamp += MSSP_TESTS_BUDGET_60HZ)
+    {
+        frameBudget = MSSPQualityGovernorFrameBudgetOfFrame(timestamp, timestamp + MSSP_TESTS_BUDGET_60HZ, MSSP_TESTS_BUDGET_120HZ);
+        MSSPQualityGovernorSetFrameBudget(&governor, frameBudget);
+        MSSPQualityGovernorRecordFrame(&governor, MSSP_TESTS_BUDGET_60HZ);
+    }
+    
+    MSSP_TEST_ASSERT(governor.level == MSSPQualityLevelFull);
+    MSSP_TEST_ASSERT(governor.missedFramesCount == 0);
+    
+    MSSPQualityGovernorInit(&governor, MSSP_TESTS_BUDGET_120HZ);
+    MSSP_TEST_ASSERT(MSSPTestsRecordFrames(&governor, MSSP_TESTS_BUDGET_60HZ, MSSP_QUALITY_GOVERNOR_WINDOW_SIZE * 4) == MSSPQualityLevelSnapshotCenter);
+}
+
+#pragma mark - Suite
+
+void MSSPQualityGovernorTests(void)
+{
+    MSSPTestsStepDown();
+    MSSPTestsStepDownThreshold();
+    MSSPTestsStepUp();
+    MSSPTestsHysteresis();
+    MSSPTestsLowPower();
+    MSSPTestsFrameBudget();
+    MSSPTestsRequestedFrameRate();
+}
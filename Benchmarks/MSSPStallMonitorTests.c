@@ -0,0 +1,161 @@
+//  MSSPStallMonitorTests.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <math.h>
+
+#include "MSSPCoreTests.h"
+#include "MSSPStallMonitor.h"
+
+#pragma mark - Macros
+
+#define MSSP_TESTS_THRESHOLD        0.1
+#define MSSP_TESTS_TOLERANCE        1e-9
+
+#define MSSP_TESTS_EQUAL(a, b)      (fabs((a) - (b)) < MSSP_TESTS_TOLERANCE)
+
+#pragma mark - Tests
+
+/**
+ *  A stall in nested phases is attributed to the phase which took most of the time, and each phase only counts the time it was the innermost one.
+ */
+static void MSSPTestsNestedPhases(void)
+{
+    MSSPStallMonitor    monitor;
+    MSSPStall           stall;
+    
+    MSSPStallMonitorInit(&monitor, MSSP_TESTS_THRESHOLD);
+    MSSPStallMonitorBeginTransition(&monitor);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 1.0, &stall) == 0);
+    
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhaseDelegateCallback, 1.01);
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhasePanelLoad, 1.02);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhasePanelLoad);
+    MSSPStallMonitorExitPhase(&monitor, 1.12);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhaseDelegateCallback);
+    MSSPStallMonitorExitPhase(&monitor, 1.13);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhaseNone);
+    
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 1.15, &stall) == 1);
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.start, 1.0));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.duration, 0.15));
+    MSSP_TEST_ASSERT(stall.phase == MSSPStallPhasePanelLoad);
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhasePanelLoad], 0.10));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseDelegateCallback], 0.02));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseNone], 0.03));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseCompletionBlock], 0));
+}
+
+/**
+ *  A phase still running at the heartbeat is accounted up to the heartbeat, and goes on in the next interval.
+ */
+static void MSSPTestsRunningPhase(void)
+{
+    MSSPStallMonitor    monitor;
+    MSSPStall           stall;
+    
+    MSSPStallMonitorInit(&monitor, MSSP_TESTS_THRESHOLD);
+    MSSPStallMonitorBeginTransition(&monitor);
+    MSSPStallMonitorHeartbeat(&monitor, 2.0, NULL);
+    
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhaseCompletionBlock, 2.05);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 2.3, &stall) == 1);
+    MSSP_TEST_ASSERT(stall.phase == MSSPStallPhaseCompletionBlock);
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseCompletionBlock], 0.25));
+    
+    MSSPStallMonitorExitPhase(&monitor, 2.35);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 2.5, &stall) == 1);
+    MSSP_TEST_ASSERT(stall.phase == MSSPStallPhaseNone);
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseCompletionBlock], 0.05));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseNone], 0.15));
+}
+
+/**
+ *  An interval is only a stall if it lasts more than the threshold while a transition has been running.
+ */
+static void MSSPTestsThreshold(void)
+{
+    MSSPStallMonitor    monitor;
+    
+    MSSPStallMonitorInit(&monitor, MSSP_TESTS_THRESHOLD);
+    MSSPStallMonitorHeartbeat(&monitor, 3.0, NULL);
+    
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhasePanelLoad, 3.0);
+    MSSPStallMonitorExitPhase(&monitor, 3.5);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 3.5, NULL) == 0);
+    
+    MSSPStallMonitorBeginTransition(&monitor);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 3.5 + MSSP_TESTS_THRESHOLD / 2, NULL) == 0);
+    MSSPStallMonitorEndTransition(&monitor);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 4.0, NULL) == 1);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 4.5, NULL) == 0);
+    
+    MSSPStallMonitorBeginTransition(&monitor);
+    MSSPStallMonitorResume(&monitor, 5.0);
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 5.0 + MSSP_TESTS_THRESHOLD * 2, NULL) == 1);
+}
+
+/**
+ *  The phases nested deeper than the maximum depth are attributed to the deepest kept one.
+ */
+static void MSSPTestsMaximumDepth(void)
+{
+    size_t              i;
+    MSSPStallMonitor    monitor;
+    MSSPStall           stall;
+    
+    MSSPStallMonitorInit(&monitor, MSSP_TESTS_THRESHOLD);
+    MSSPStallMonitorBeginTransition(&monitor);
+    MSSPStallMonitorHeartbeat(&monitor, 6.0, NULL);
+    
+    for (i = 0; i < MSSP_STALL_MONITOR_MAXIMUM_DEPTH - 1; i++)
+        MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhaseDelegateCallback, 6.0);
+    
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhaseStatusBarUpdate, 6.0);
+    MSSPStallMonitorEnterPhase(&monitor, MSSPStallPhasePanelLoad, 6.0);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhaseStatusBarUpdate);
+    
+    MSSPStallMonitorExitPhase(&monitor, 6.2);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhaseStatusBarUpdate);
+    MSSPStallMonitorExitPhase(&monitor, 6.2);
+    MSSP_TEST_ASSERT(MSSPStallMonitorGetCurrentPhase(&monitor) == MSSPStallPhaseDelegateCallback);
+    
+    MSSP_TEST_ASSERT(MSSPStallMonitorHeartbeat(&monitor, 6.25, &stall) == 1);
+    MSSP_TEST_ASSERT(stall.phase == MSSPStallPhaseStatusBarUpdate);
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseStatusBarUpdate], 0.2));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhasePanelLoad], 0));
+    MSSP_TEST_ASSERT(MSSP_TESTS_EQUAL(stall.phaseDurations[MSSPStallPhaseDelegateCallback], 0.05));
+}
+
+#pragma mark - Suite
+
+void MSSPStallMonitorTests(void)
+{
+    MSSPTestsNestedPhases();
+    MSSPTestsRunningPhase();
+    MSSPTestsThreshold();
+    MSSPTestsMaximumDepth();
+}
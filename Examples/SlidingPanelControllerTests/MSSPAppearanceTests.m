@@ -0,0 +1,332 @@
+//  MSSPAppearanceTests.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <XCTest/XCTest.h>
+
+#import "MSSlidingPanelController.h"
+#import "XCTestCase+MSSPWaiting.h"
+
+#pragma mark - MSSPCountingViewController interface
+
+/**
+ *  A view controller which counts the appearance methods it receives.
+ */
+@interface MSSPCountingViewController : UIViewController
+
+#pragma mark Properties
+/** @name Properties */
+
+/**
+ *  The number of `viewWillAppear:` received.
+ */
+@property (nonatomic, assign)   NSUInteger  viewWillAppearCount;
+
+/**
+ *  The number of `viewDidAppear:` received.
+ */
+@property (nonatomic, assign)   NSUInteger  viewDidAppearCount;
+
+/**
+ *  The number of `viewWillDisappear:` received.
+ */
+@property (nonatomic, assign)   NSUInteger  viewWillDisappearCount;
+
+/**
+ *  The number of `viewDidDisappear:` received.
+ */
+@property (nonatomic, assign)   NSUInteger  viewDidDisappearCount;
+
+@end
+
+#pragma mark - MSSPCountingViewController implementation
+
+@implementation MSSPCountingViewController
+
+#pragma mark Appearance
+/** @name Appearance */
+
+/**
+ *  Count the notification that the view is about to be added to a view hierarchy.
+ *
+ *  @param animated If YES, the transition is animated.
+ */
+- (void)viewWillAppear:(BOOL)animated
+{
+    [super viewWillAppear:animated];
+    [self setViewWillAppearCount:[self viewWillAppearCount] + 1];
+}
+
+/**
+ *  Count the notification that the view was added to a view hierarchy.
+ *
+ *  @param animated If YES, the transition is animated.
+ */
+- (void)viewDidAppear:(BOOL)animated
+{
+    [super viewDidAppear:animated];
+    [self setViewDidAppearCount:[self viewDidAppearCount] + 1];
+}
+
+/**
+ *  Count the notification that the view is about to be removed from a view hierarchy.
+ *
+ *  @param animated If YES, the transition is animated.
+ */
+- (void)viewWillDisappear:(BOOL)animated
+{
+    [super viewWillDisappear:animated];
+    [self setViewWillDisappearCount:[self viewWillDisappearCount] + 1];
+}
+
+/**
+ *  Count the notification that the view was removed from a view hierarchy.
+ *
+ *  @param animated If YES, the transition is animated.
+ */
+- (void)viewDidDisappear:(BOOL)animated
+{
+    [super viewDidDisappear:animated];
+    [self setViewDidDisappearCount:[self viewDidDisappearCount] + 1];
+}
+
+@end
+
+#pragma mark - MSSPAppearanceTests interface
+
+/**
+ *  Check that the center view controller and the panels receive balanced appearance methods, only when they are really shown or hidden.
+ */
+@interface MSSPAppearanceTests : XCTestCase
+
+#pragma mark Properties
+/** @name Properties */
+
+@property (nonatomic, strong)   UIWindow                    *window;
+@property (nonatomic, strong)   MSSlidingPanelController    *slidingPanelController;
+@property (nonatomic, strong)   MSSPCountingViewController  *centerController;
+@property (nonatomic, strong)   MSSPCountingViewController  *leftController;
+@property (nonatomic, strong)   MSSPCountingViewController  *rightController;
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Check the appearance methods received by a controller.
+ *
+ *  @param controller    The controller.
+ *  @param willAppear    The expected number of `viewWillAppear:`.
+ *  @param didAppear     The expected number of `viewDidAppear:`.
+ *  @param willDisappear The expected number of `viewWillDisappear:`.
+ *  @param didDisappear  The expected number of `viewDidDisappear:`.
+ */
+- (void)checkController:(MSSPCountingViewController *)controller willAppear:(NSUInteger)willAppear didAppear:(NSUInteger)didAppear willDisappear:(NSUInteger)willDisappear didDisappear:(NSUInteger)didDisappear;
+
+/**
+ *  Display a side with an animation and wait for the end of the transition.
+ *
+ *  @param side The side to display.
+ *
+ *  @return The result of the transition.
+ */
+- (MSSPTransitionResult)displaySide:(MSSPSideDisplayed)side;
+
+@end
+
+#pragma mark - MSSPAppearanceTests implementation
+
+@implementation MSSPAppearanceTests
+
+#pragma mark Set up and tear down
+/** @name Set up and tear down */
+
+/**
+ *  Display a sliding panel controller with counting controllers in a new window, and wait for the center view controller to appear.
+ */
+- (void)setUp
+{
+    MSSPCountingViewController  *centerController;
+    
+    [super setUp];
+    
+    centerController = [[MSSPCountingViewController alloc] init];
+    
+    [self setCenterController:centerController];
+    [self setLeftController:[[MSSPCountingViewController alloc] init]];
+    [self setRightController:[[MSSPCountingViewController alloc] init]];
+    [self setSlidingPanelController:[[MSSlidingPanelController alloc] initWithCenterViewController:[self centerController]
+                                                                               leftPanelController:[self leftController]
+                                                                           andRightPanelController:[self rightController]]];
+    
+    [self setWindow:[[UIWindow alloc] initWithFrame:[[UIScreen mainScreen] bounds]]];
+    [[self window] setRootViewController:[self slidingPanelController]];
+    [[self window] makeKeyAndVisible];
+    
+    XCTAssertTrue([self waitForCondition:^BOOL{ return ([centerController viewDidAppearCount] == 1); }]);
+}
+
+/**
+ *  Remove the window.
+ */
+- (void)tearDown
+{
+    [[self window] setHidden:YES];
+    [[self window] setRootViewController:nil];
+    [self setWindow:nil];
+    
+    [super tearDown];
+}
+
+#pragma mark Tests
+/** @name Tests */
+
+/**
+ *  Only the center view controller appears with the sliding panel controller.
+ */
+- (void)testInitialAppearance
+{
+    [self checkController:[self centerController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+    [self checkController:[self leftController] willAppear:0 didAppear:0 willDisappear:0 didDisappear:0];
+    [self checkController:[self rightController] willAppear:0 didAppear:0 willDisappear:0 didDisappear:0];
+    XCTAssertTrue([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    XCTAssertTrue([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedRight]);
+}
+
+/**
+ *  A panel appears when it is opened and disappears when it is closed, the center view controller is not told.
+ */
+- (void)testOpenAndClose
+{
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedLeft], MSSPTransitionResultCompleted);
+    [self checkController:[self leftController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+    XCTAssertFalse([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedNone], MSSPTransitionResultCompleted);
+    [self checkController:[self leftController] willAppear:1 didAppear:1 willDisappear:1 didDisappear:1];
+    XCTAssertTrue([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    
+    [self checkController:[self centerController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+    [self checkController:[self rightController] willAppear:0 didAppear:0 willDisappear:0 didDisappear:0];
+}
+
+/**
+ *  When the displayed side switches, the previous panel disappears before the new one appears.
+ */
+- (void)testSideSwitch
+{
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedLeft], MSSPTransitionResultCompleted);
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedRight], MSSPTransitionResultCompleted);
+    [self checkController:[self leftController] willAppear:1 didAppear:1 willDisappear:1 didDisappear:1];
+    [self checkController:[self rightController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+    
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedLeft], MSSPTransitionResultCompleted);
+    [self checkController:[self leftController] willAppear:2 didAppear:2 willDisappear:1 didDisappear:1];
+    [self checkController:[self rightController] willAppear:1 didAppear:1 willDisappear:1 didDisappear:1];
+    
+    [self checkController:[self centerController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+}
+
+/**
+ *  A panel partially revealed by a drag which is then cancelled begins to appear, then disappears without having appeared.
+ */
+- (void)testCancelledDrag
+{
+    [[self slidingPanelController] beginInteractiveReveal:MSSPSideDisplayedLeft];
+    [[self slidingPanelController] updateRevealFraction:0.2];
+    [self checkController:[self leftController] willAppear:1 didAppear:0 willDisappear:0 didDisappear:0];
+    
+    [[self slidingPanelController] finishInteractiveRevealWithVelocity:0];
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedNone], MSSPTransitionResultUnchanged);
+    [self checkController:[self leftController] willAppear:1 didAppear:0 willDisappear:1 didDisappear:1];
+    XCTAssertTrue([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    
+    [self checkController:[self centerController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+    [self checkController:[self rightController] willAppear:0 didAppear:0 willDisappear:0 didDisappear:0];
+}
+
+/**
+ *  A panel mostly revealed by a reveal which is then cancelled goes back to the side displayed before, and disappears without having appeared.
+ */
+- (void)testCancelledReveal
+{
+    [[self slidingPanelController] beginInteractiveReveal:MSSPSideDisplayedLeft];
+    [[self slidingPanelController] updateRevealFraction:0.8];
+    [[self slidingPanelController] cancelInteractiveReveal];
+    
+    XCTAssertEqual([self displaySide:MSSPSideDisplayedNone], MSSPTransitionResultUnchanged);
+    [self checkController:[self leftController] willAppear:1 didAppear:0 willDisappear:1 didDisappear:1];
+    XCTAssertTrue([[self slidingPanelController] isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    
+    [self checkController:[self centerController] willAppear:1 didAppear:1 willDisappear:0 didDisappear:0];
+}
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Check the appearance methods received by a controller.
+ *
+ *  @param controller    The controller.
+ *  @param willAppear    The expected number of `viewWillAppear:`.
+ *  @param didAppear     The expected number of `viewDidAppear:`.
+ *  @param willDisappear The expected number of `viewWillDisappear:`.
+ *  @param didDisappear  The expected number of `viewDidDisappear:`.
+ */
+- (void)checkController:(MSSPCountingViewController *)controller willAppear:(NSUInteger)willAppear didAppear:(NSUInteger)didAppear willDisappear:(NSUInteger)willDisappear didDisappear:(NSUInteger)didDisappear
+{
+    XCTAssertEqual([controller viewWillAppearCount], willAppear, @"viewWillAppear: of %@", controller);
+    XCTAssertEqual([controller viewDidAppearCount], didAppear, @"viewDidAppear: of %@", controller);
+    XCTAssertEqual([controller viewWillDisappearCount], willDisappear, @"viewWillDisappear: of %@", controller);
+    XCTAssertEqual([controller viewDidDisappearCount], didDisappear, @"viewDidDisappear: of %@", controller);
+}
+
+/**
+ *  Display a side with an animation and wait for the end of the transition.
+ *
+ *  @param side The side to display.
+ *
+ *  @return The result of the transition.
+ */
+- (MSSPTransitionResult)displaySide:(MSSPSideDisplayed)side
+{
+    __block BOOL                    done;
+    __block MSSPTransitionResult    transitionResult;
+    
+    done = NO;
+    transitionResult = MSSPTransitionResultCancelled;
+    
+    [[self slidingPanelController] setSideDisplayed:side animated:YES completion:^(MSSPTransitionResult result)
+     {
+         transitionResult = result;
+         done = YES;
+     }];
+    
+    XCTAssertTrue([self waitForCondition:^BOOL{ return (done); }]);
+    
+    return (transitionResult);
+}
+
+@end
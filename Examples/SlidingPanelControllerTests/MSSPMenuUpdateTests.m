@@ -0,0 +1,453 @@
+//  MSSPMenuUpdateTests.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <XCTest/XCTest.h>
+
+#import "MSSlidingPanelMenuController.h"
+#import "XCTestCase+MSSPWaiting.h"
+
+#pragma mark - Global variables
+
+/**
+ *  The number of changes beyond which the whole table view is reloaded. It must match `g_menuUpdateMaximumChanges`.
+ */
+static const NSUInteger g_MUTMaximumChanges = 500;
+
+#pragma mark - MSSPMenuUpdate interface
+
+/**
+ *  The part of the private `MSSPMenuUpdate` class used by the tests. The class is looked up at runtime, as it belongs to the application.
+ */
+@interface MSSPMenuUpdate : NSObject
+
++ (MSSPMenuUpdate *)menuUpdateFromSections:(NSArray *)oldSections toSections:(NSArray *)newSections;
+
+@property (nonatomic, strong)   NSMutableIndexSet   *deletedSections;
+@property (nonatomic, strong)   NSMutableArray      *deletedRows;
+@property (nonatomic, strong)   NSMutableIndexSet   *insertedSections;
+@property (nonatomic, strong)   NSMutableArray      *insertedRows;
+@property (nonatomic, assign)   BOOL                reloadData;
+@property (nonatomic, strong)   NSMutableIndexSet   *reloadedSections;
+@property (nonatomic, strong)   NSMutableArray      *reloadedRows;
+
+@end
+
+#pragma mark - MSSPMenuUpdateTests interface
+
+/**
+ *  Check the changes computed between two versions of a menu, and that they can be applied to a table view.
+ */
+@interface MSSPMenuUpdateTests : XCTestCase
+
+#pragma mark Properties
+/** @name Properties */
+
+@property (nonatomic, strong)   UIWindow                        *window;
+@property (nonatomic, strong)   MSSlidingPanelMenuController    *menuController;
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Display a menu in a new window.
+ *
+ *  @param sections The sections of the menu.
+ */
+- (void)displayMenuWithSections:(NSArray *)sections;
+
+/**
+ *  Set new sections to the displayed menu, wait for them to be displayed and check the rows of the table view.
+ *
+ *  @param sections The new sections.
+ */
+- (void)updateMenuToSections:(NSArray *)sections;
+
+/**
+ *  Check that the table view displays sections.
+ *
+ *  @param sections The sections.
+ */
+- (void)checkTableViewDisplaysSections:(NSArray *)sections;
+
+/**
+ *  Compute the changes between two versions of a menu.
+ *
+ *  @param oldSections The sections currently displayed.
+ *  @param newSections The sections to display.
+ *
+ *  @return The changes.
+ */
+- (MSSPMenuUpdate *)menuUpdateFromSections:(NSArray *)oldSections toSections:(NSArray *)newSections;
+
+/**
+ *  Create and return an item.
+ *
+ *  @param identifier The identifier of the item.
+ *  @param name       The name of the item.
+ *
+ *  @return The item.
+ */
+- (MSSPMenuItem *)itemWithIdentifier:(NSString *)identifier name:(NSString *)name;
+
+/**
+ *  Create and return a section.
+ *
+ *  @param identifier The identifier of the section.
+ *  @param name       The name of the section.
+ *  @param items      The items of the section, as `MSSPMenuItem` objects or as identifiers which are also their names.
+ *
+ *  @return The section.
+ */
+- (MSSPMenuSection *)sectionWithIdentifier:(NSString *)identifier name:(NSString *)name items:(NSArray *)items;
+
+@end
+
+#pragma mark - MSSPMenuUpdateTests implementation
+
+@implementation MSSPMenuUpdateTests
+
+#pragma mark Set up and tear down
+/** @name Set up and tear down */
+
+/**
+ *  Remove the window.
+ */
+- (void)tearDown
+{
+    [[self window] setHidden:YES];
+    [[self window] setRootViewController:nil];
+    [self setWindow:nil];
+    [self setMenuController:nil];
+    
+    [super tearDown];
+}
+
+#pragma mark Tests
+/** @name Tests */
+
+/**
+ *  Sections and rows are deleted by their old index, inserted by their new index, and reloaded by their old index, across several sections.
+ */
+- (void)testChangesAcrossSections
+{
+    NSArray         *newSections;
+    NSArray         *oldSections;
+    MSSPMenuUpdate  *update;
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a", @"b", @"c"]],
+                    [self sectionWithIdentifier:@"B" name:@"B" items:@[@"d", @"e"]],
+                    [self sectionWithIdentifier:@"C" name:@"C" items:@[@"f", @"g"]],
+                    [self sectionWithIdentifier:@"E" name:@"E" items:@[@"h"]]];
+    newSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a", @"c", @"x"]],
+                    [self sectionWithIdentifier:@"D" name:@"D" items:@[@"y"]],
+                    [self sectionWithIdentifier:@"C" name:@"C" items:@[@"f", [self itemWithIdentifier:@"g" name:@"G"]]],
+                    [self sectionWithIdentifier:@"E" name:@"E renamed" items:@[@"h"]]];
+    
+    update = [self menuUpdateFromSections:oldSections toSections:newSections];
+    
+    XCTAssertFalse([update reloadData]);
+    XCTAssertEqualObjects([update deletedSections], [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqualObjects([update insertedSections], [NSIndexSet indexSetWithIndex:1]);
+    XCTAssertEqualObjects([update reloadedSections], [NSIndexSet indexSetWithIndex:3]);
+    XCTAssertEqualObjects([update deletedRows], @[[NSIndexPath indexPathForRow:1 inSection:0]]);
+    XCTAssertEqualObjects([update insertedRows], @[[NSIndexPath indexPathForRow:2 inSection:0]]);
+    XCTAssertEqualObjects([update reloadedRows], @[[NSIndexPath indexPathForRow:1 inSection:2]]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+}
+
+/**
+ *  A reordering of the sections reloads the whole table view.
+ */
+- (void)testReorderedSectionsFallback
+{
+    NSArray *newSections;
+    NSArray *oldSections;
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]], [self sectionWithIdentifier:@"B" name:@"B" items:@[@"b", @"c"]]];
+    newSections = @[[self sectionWithIdentifier:@"B" name:@"B" items:@[@"b", @"c"]], [self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]]];
+    
+    XCTAssertTrue([[self menuUpdateFromSections:oldSections toSections:newSections] reloadData]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+}
+
+/**
+ *  A section identifier used several times reloads the whole table view.
+ */
+- (void)testDuplicatedSectionsFallback
+{
+    NSArray *newSections;
+    NSArray *oldSections;
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]]];
+    newSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]], [self sectionWithIdentifier:@"A" name:@"A bis" items:@[@"b", @"c"]]];
+    
+    XCTAssertTrue([[self menuUpdateFromSections:oldSections toSections:newSections] reloadData]);
+    XCTAssertTrue([[self menuUpdateFromSections:newSections toSections:oldSections] reloadData]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+    [self updateMenuToSections:oldSections];
+}
+
+/**
+ *  A reordering of the items of a section reloads this section only, without row changes in it.
+ */
+- (void)testReorderedItemsFallback
+{
+    NSArray         *newSections;
+    NSArray         *oldSections;
+    MSSPMenuUpdate  *update;
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a", @"b", @"c"]], [self sectionWithIdentifier:@"B" name:@"B" items:@[@"d"]]];
+    newSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"c", @"a", @"x"]], [self sectionWithIdentifier:@"B" name:@"B" items:@[@"d", @"e"]]];
+    
+    update = [self menuUpdateFromSections:oldSections toSections:newSections];
+    
+    XCTAssertFalse([update reloadData]);
+    XCTAssertEqualObjects([update reloadedSections], [NSIndexSet indexSetWithIndex:0]);
+    XCTAssertEqualObjects([update deletedRows], @[]);
+    XCTAssertEqualObjects([update insertedRows], @[[NSIndexPath indexPathForRow:1 inSection:1]]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+}
+
+/**
+ *  An item identifier used several times in a section reloads this section only.
+ */
+- (void)testDuplicatedItemsFallback
+{
+    NSArray         *newSections;
+    NSArray         *oldSections;
+    MSSPMenuUpdate  *update;
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]], [self sectionWithIdentifier:@"B" name:@"B" items:@[@"b"]]];
+    newSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a", [self itemWithIdentifier:@"a" name:@"a bis"]]],
+                    [self sectionWithIdentifier:@"B" name:@"B" items:@[]]];
+    
+    update = [self menuUpdateFromSections:oldSections toSections:newSections];
+    
+    XCTAssertFalse([update reloadData]);
+    XCTAssertEqualObjects([update reloadedSections], [NSIndexSet indexSetWithIndex:0]);
+    XCTAssertEqualObjects([update deletedRows], @[[NSIndexPath indexPathForRow:0 inSection:1]]);
+    XCTAssertEqualObjects([update insertedRows], @[]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+}
+
+/**
+ *  Too many changes reload the whole table view.
+ */
+- (void)testTooManyChangesFallback
+{
+    NSUInteger      i;
+    NSMutableArray  *items;
+    NSArray         *newSections;
+    NSArray         *oldSections;
+    
+    items = [[NSMutableArray alloc] initWithCapacity:g_MUTMaximumChanges + 1];
+    for (i = 0; i <= g_MUTMaximumChanges; i++)
+        [items addObject:[NSString stringWithFormat:@"item %lu", (unsigned long)i]];
+    
+    oldSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[]]];
+    newSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:items]];
+    
+    XCTAssertTrue([[self menuUpdateFromSections:oldSections toSections:newSections] reloadData]);
+    XCTAssertFalse([[self menuUpdateFromSections:oldSections toSections:@[[self sectionWithIdentifier:@"A" name:@"A" items:[items subarrayWithRange:NSMakeRange(0, g_MUTMaximumChanges)]]]] reloadData]);
+    
+    [self displayMenuWithSections:oldSections];
+    [self updateMenuToSections:newSections];
+}
+
+/**
+ *  Sections set while an update is in progress are merged into a single update, which displays the last ones and executes every completion block in order.
+ */
+- (void)testQueuedUpdatesMerge
+{
+    NSMutableArray  *completions;
+    NSArray         *firstSections;
+    NSUInteger      i;
+    NSArray         *lastSections;
+    NSMutableArray  *rowsCounts;
+    UITableView     *tableView;
+    
+    [self displayMenuWithSections:@[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a"]]]];
+    
+    firstSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"a", @"b"]]];
+    lastSections = @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"b", @"c", @"d", @"e"]], [self sectionWithIdentifier:@"B" name:@"B" items:@[@"f"]]];
+    completions = [[NSMutableArray alloc] init];
+    rowsCounts = [[NSMutableArray alloc] init];
+    tableView = [[self menuController] tableView];
+    
+    [[self menuController] setSections:firstSections animated:YES completion:^(void)
+     {
+         [completions addObject:@1];
+     }];
+    
+    for (i = 2; i <= 4; i++)
+    {
+        [[self menuController] setSections:(i == 4 ? lastSections : @[[self sectionWithIdentifier:@"A" name:@"A" items:@[@"z"]]]) animated:YES completion:^(void)
+         {
+             [completions addObject:@(i)];
+             [rowsCounts addObject:@([tableView numberOfRowsInSection:0])];
+         }];
+    }
+    
+    XCTAssertTrue([self waitForCondition:^BOOL{ return ([completions count] == 4); }]);
+    XCTAssertEqualObjects(completions, (@[@1, @2, @3, @4]));
+    // The intermediate sections, with a single row, are never displayed.
+    XCTAssertEqualObjects(rowsCounts, (@[@4, @4, @4]));
+    [self checkTableViewDisplaysSections:lastSections];
+}
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Display a menu in a new window.
+ *
+ *  @param sections The sections of the menu.
+ */
+- (void)displayMenuWithSections:(NSArray *)sections
+{
+    [self setMenuController:[[MSSlidingPanelMenuController alloc] initWithSections:sections]];
+    [self setWindow:[[UIWindow alloc] initWithFrame:[[UIScreen mainScreen] bounds]]];
+    [[self window] setRootViewController:[self menuController]];
+    [[self window] makeKeyAndVisible];
+    [[[self menuController] tableView] layoutIfNeeded];
+    
+    [self checkTableViewDisplaysSections:sections];
+}
+
+/**
+ *  Set new sections to the displayed menu, wait for them to be displayed and check the rows of the table view.
+ *
+ *  An invalid change raises an exception in the table view.
+ *
+ *  @param sections The new sections.
+ */
+- (void)updateMenuToSections:(NSArray *)sections
+{
+    __block BOOL    done;
+    
+    done = NO;
+    
+    [[self menuController] setSections:sections animated:YES completion:^(void)
+     {
+         done = YES;
+     }];
+    
+    XCTAssertTrue([self waitForCondition:^BOOL{ return (done); }]);
+    [self checkTableViewDisplaysSections:sections];
+}
+
+/**
+ *  Check that the table view displays sections.
+ *
+ *  @param sections The sections.
+ */
+- (void)checkTableViewDisplaysSections:(NSArray *)sections
+{
+    NSUInteger  i;
+    UITableView *tableView;
+    
+    tableView = [[self menuController] tableView];
+    
+    XCTAssertEqual((NSUInteger)[tableView numberOfSections], [sections count]);
+    
+    for (i = 0; i < [sections count] && i < (NSUInteger)[tableView numberOfSections]; i++)
+        XCTAssertEqual((NSUInteger)[tableView numberOfRowsInSection:i], [[sections objectAtIndex:i] numberOfItems], @"section %lu", (unsigned long)i);
+}
+
+/**
+ *  Compute the changes between two versions of a menu.
+ *
+ *  @param oldSections The sections currently displayed.
+ *  @param newSections The sections to display.
+ *
+ *  @return The changes.
+ */
+- (MSSPMenuUpdate *)menuUpdateFromSections:(NSArray *)oldSections toSections:(NSArray *)newSections
+{
+    Class   menuUpdateClass;
+    
+    menuUpdateClass = NSClassFromString(@"MSSPMenuUpdate");
+    XCTAssertNotNil(menuUpdateClass);
+    
+    return ([menuUpdateClass menuUpdateFromSections:oldSections toSections:newSections]);
+}
+
+/**
+ *  Create and return an item.
+ *
+ *  @param identifier The identifier of the item.
+ *  @param name       The name of the item.
+ *
+ *  @return The item.
+ */
+- (MSSPMenuItem *)itemWithIdentifier:(NSString *)identifier name:(NSString *)name
+{
+    MSSPMenuItem    *item;
+    
+    item = [MSSPMenuItem menuItemUncheckableWithName:name];
+    [item setIdentifier:identifier];
+    
+    return (item);
+}
+
+/**
+ *  Create and return a section.
+ *
+ *  @param identifier The identifier of the section.
+ *  @param name       The name of the section.
+ *  @param items      The items of the section, as `MSSPMenuItem` objects or as identifiers which are also their names.
+ *
+ *  @return The section.
+ */
+- (MSSPMenuSection *)sectionWithIdentifier:(NSString *)identifier name:(NSString *)name items:(NSArray *)items
+{
+    id              item;
+    NSMutableArray  *menuItems;
+    MSSPMenuSection *section;
+    
+    menuItems = [[NSMutableArray alloc] initWithCapacity:[items count]];
+    
+    for (item in items)
+        [menuItems addObject:([item isKindOfClass:[MSSPMenuItem class]] ? item : [self itemWithIdentifier:item name:item])];
+    
+    section = [MSSPMenuSection menuSectionWithName:name selectionRule:MSSPMenuSelectionRuleNone andItems:menuItems];
+    [section setIdentifier:identifier];
+    
+    return (section);
+}
+
+@end
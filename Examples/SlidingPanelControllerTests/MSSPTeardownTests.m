@@ -0,0 +1,195 @@
+//  MSSPTeardownTests.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <XCTest/XCTest.h>
+
+#import "MSSlidingPanelController.h"
+#import "XCTestCase+MSSPWaiting.h"
+
+#pragma mark - Global variables
+
+/**
+ *  The number of controller graphs built and destroyed by each test.
+ */
+static const NSUInteger g_TTIterationsCount = 10;
+
+#pragma mark - MSSPTeardownTests interface
+
+/**
+ *  Check that a sliding panel controller, its view and its child view controllers are freed once they are no longer used, whatever they have done.
+ */
+@interface MSSPTeardownTests : XCTestCase
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Build a controller graph, display it in a window, optionally slide its panels, then remove it from the window.
+ *
+ *  @param references Filled with weak references to the objects of the graph.
+ *  @param slide      `YES` to open and close the panels with animations and an interactive reveal, else `NO`.
+ */
+- (void)buildControllerGraphWithReferences:(NSPointerArray *)references slide:(BOOL)slide;
+
+/**
+ *  Build and destroy controller graphs, and check that all their objects are freed.
+ *
+ *  @param slide `YES` to open and close the panels of each graph, else `NO`.
+ */
+- (void)checkTeardownWithSlide:(BOOL)slide;
+
+/**
+ *  Display a side with an animation and wait for the end of the transition.
+ *
+ *  @param side                   The side to display.
+ *  @param slidingPanelController The sliding panel controller.
+ */
+- (void)displaySide:(MSSPSideDisplayed)side ofSlidingPanelController:(MSSlidingPanelController *)slidingPanelController;
+
+@end
+
+#pragma mark - MSSPTeardownTests implementation
+
+@implementation MSSPTeardownTests
+
+#pragma mark Tests
+/** @name Tests */
+
+/**
+ *  A controller graph which has only been displayed is freed.
+ */
+- (void)testTeardownAfterDisplay
+{
+    [self checkTeardownWithSlide:NO];
+}
+
+/**
+ *  A controller graph whose panels have been opened and closed is freed: the animations, the frame monitor and the transition queue don't keep it alive.
+ */
+- (void)testTeardownAfterSlides
+{
+    [self checkTeardownWithSlide:YES];
+}
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Build a controller graph, display it in a window, optionally slide its panels, then remove it from the window.
+ *
+ *  @param references Filled with weak references to the objects of the graph.
+ *  @param slide      `YES` to open and close the panels with animations and an interactive reveal, else `NO`.
+ */
+- (void)buildControllerGraphWithReferences:(NSPointerArray *)references slide:(BOOL)slide
+{
+    UIViewController            *centerController;
+    UIViewController            *leftController;
+    UIViewController            *rightController;
+    MSSlidingPanelController    *slidingPanelController;
+    UIWindow                    *window;
+    
+    centerController = [[UIViewController alloc] init];
+    leftController = [[UIViewController alloc] init];
+    rightController = [[UIViewController alloc] init];
+    slidingPanelController = [[MSSlidingPanelController alloc] initWithCenterViewController:centerController leftPanelController:leftController andRightPanelController:rightController];
+    
+    // The adaptive quality runs the frame monitor even on 60 Hz screens.
+    [slidingPanelController setAdaptiveQualityEnabled:YES];
+    [slidingPanelController setFrameRateSink:^(MSSPFrameRateReport __unused report) {}];
+    [slidingPanelController setStallWatchdogEnabled:YES];
+    
+    window = [[UIWindow alloc] initWithFrame:[[UIScreen mainScreen] bounds]];
+    [window setRootViewController:slidingPanelController];
+    [window makeKeyAndVisible];
+    
+    if (slide)
+    {
+        [self displaySide:MSSPSideDisplayedLeft ofSlidingPanelController:slidingPanelController];
+        [self displaySide:MSSPSideDisplayedRight ofSlidingPanelController:slidingPanelController];
+        [self displaySide:MSSPSideDisplayedNone ofSlidingPanelController:slidingPanelController];
+        
+        [slidingPanelController beginInteractiveReveal:MSSPSideDisplayedLeft];
+        [slidingPanelController updateRevealFraction:0.8];
+        [slidingPanelController finishInteractiveRevealWithVelocity:0];
+        [self displaySide:MSSPSideDisplayedLeft ofSlidingPanelController:slidingPanelController];
+    }
+    
+    [window setHidden:YES];
+    [window setRootViewController:nil];
+    
+    [references addPointer:(__bridge void *)slidingPanelController];
+    [references addPointer:(__bridge void *)[slidingPanelController view]];
+    [references addPointer:(__bridge void *)centerController];
+    [references addPointer:(__bridge void *)leftController];
+    [references addPointer:(__bridge void *)rightController];
+}
+
+/**
+ *  Build and destroy controller graphs, and check that all their objects are freed.
+ *
+ *  @param slide `YES` to open and close the panels of each graph, else `NO`.
+ */
+- (void)checkTeardownWithSlide:(BOOL)slide
+{
+    NSUInteger      i;
+    NSPointerArray  *references;
+    
+    references = [NSPointerArray weakObjectsPointerArray];
+    
+    for (i = 0; i < g_TTIterationsCount; i++)
+    {
+        @autoreleasepool
+        {
+            [self buildControllerGraphWithReferences:references slide:slide];
+        }
+    }
+    
+    XCTAssertEqual([references count], g_TTIterationsCount * 5);
+    XCTAssertTrue([self waitForCondition:^BOOL{ return ([[references allObjects] count] == 0); }], @"Objects still alive: %@", [references allObjects]);
+}
+
+/**
+ *  Display a side with an animation and wait for the end of the transition.
+ *
+ *  @param side                   The side to display.
+ *  @param slidingPanelController The sliding panel controller.
+ */
+- (void)displaySide:(MSSPSideDisplayed)side ofSlidingPanelController:(MSSlidingPanelController *)slidingPanelController
+{
+    __block BOOL    done;
+    
+    done = NO;
+    
+    [slidingPanelController setSideDisplayed:side animated:YES completion:^(MSSPTransitionResult __unused result)
+     {
+         done = YES;
+     }];
+    
+    XCTAssertTrue([self waitForCondition:^BOOL{ return (done); }]);
+}
+
+@end
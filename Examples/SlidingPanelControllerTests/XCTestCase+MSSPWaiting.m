@@ -0,0 +1,60 @@
+//  XCTestCase+MSSPWaiting.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import "XCTestCase+MSSPWaiting.h"
+
+#pragma mark - Global variables
+
+/**
+ *  The time given to a condition to become true, in seconds.
+ */
+static const NSTimeInterval g_MSSPWTimeout = 5;
+
+#pragma mark - Implementation
+
+@implementation XCTestCase (MSSPWaiting)
+
+/**
+ *  Run the main run loop until a condition is true or the timeout expires.
+ *
+ *  @param condition The condition.
+ *
+ *  @return YES if the condition is true, NO if the timeout has expired.
+ */
+- (BOOL)waitForCondition:(BOOL (^)(void))condition
+{
+    NSDate  *timeoutDate;
+    
+    timeoutDate = [NSDate dateWithTimeIntervalSinceNow:g_MSSPWTimeout];
+    
+    while (!condition() && [timeoutDate timeIntervalSinceNow] > 0)
+        [[NSRunLoop currentRunLoop] runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+    
+    return (condition());
+}
+
+@end
@@ -0,0 +1,174 @@
+//  MSSPCurves.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "MSSPCurves.h"
+
+#pragma mark - Macros
+
+/**
+ *  The formulas of the curves. They only use constant expressions, so the tables are computed by the compiler.
+ */
+#define MSSP_CURVES_EASE_IN(t)          ((t) * (t) * (t))
+#define MSSP_CURVES_EASE_OUT(t)         (1 - (1 - (t)) * (1 - (t)) * (1 - (t)))
+#define MSSP_CURVES_EASE_IN_OUT(t)      ((t) < 0.5 ? 4 * (t) * (t) * (t) : 1 - 4 * (1 - (t)) * (1 - (t)) * (1 - (t)))
+#define MSSP_CURVES_DECELERATE(t)       (1 - (1 - (t)) * (1 - (t)) * (1 - (t)) * (1 - (t)) * (1 - (t)))
+#define MSSP_CURVES_RUBBER_BAND(r)      (MSSP_CURVES_RUBBER_BAND_COEFFICIENT * (r) / (1 + MSSP_CURVES_RUBBER_BAND_COEFFICIENT * (r)))
+
+/**
+ *  The generation of the tables. `MSSP_CURVES_TABLE` expands a formula for each of the `MSSP_CURVES_TABLE_SIZE` samples, spread between 0 and `scale`.
+ */
+#define MSSP_CURVES_SAMPLE(f, scale, i) f((scale) * (double)(i) / (MSSP_CURVES_TABLE_SIZE - 1))
+#define MSSP_CURVES_SAMPLES_8(f, scale, i)                                                                                          \
+    MSSP_CURVES_SAMPLE(f, scale, (i) + 0), MSSP_CURVES_SAMPLE(f, scale, (i) + 1), MSSP_CURVES_SAMPLE(f, scale, (i) + 2),            \
+    MSSP_CURVES_SAMPLE(f, scale, (i) + 3), MSSP_CURVES_SAMPLE(f, scale, (i) + 4), MSSP_CURVES_SAMPLE(f, scale, (i) + 5),            \
+    MSSP_CURVES_SAMPLE(f, scale, (i) + 6), MSSP_CURVES_SAMPLE(f, scale, (i) + 7)
+#define MSSP_CURVES_TABLE(f, scale)                                                                                                 \
+{                                                                                                                                   \
+    MSSP_CURVES_SAMPLES_8(f, scale, 0), MSSP_CURVES_SAMPLES_8(f, scale, 8), MSSP_CURVES_SAMPLES_8(f, scale, 16),                    \
+    MSSP_CURVES_SAMPLES_8(f, scale, 24), MSSP_CURVES_SAMPLES_8(f, scale, 32), MSSP_CURVES_SAMPLES_8(f, scale, 40),                  \
+    MSSP_CURVES_SAMPLES_8(f, scale, 48), MSSP_CURVES_SAMPLES_8(f, scale, 56), MSSP_CURVES_SAMPLE(f, scale, 64)                      \
+}
+
+#pragma mark - Tables
+
+static const double g_easeInTable[] = MSSP_CURVES_TABLE(MSSP_CURVES_EASE_IN, 1);
+static const double g_easeOutTable[] = MSSP_CURVES_TABLE(MSSP_CURVES_EASE_OUT, 1);
+static const double g_easeInOutTable[] = MSSP_CURVES_TABLE(MSSP_CURVES_EASE_IN_OUT, 1);
+static const double g_decelerateTable[] = MSSP_CURVES_TABLE(MSSP_CURVES_DECELERATE, 1);
+static const double g_rubberBandTable[] = MSSP_CURVES_TABLE(MSSP_CURVES_RUBBER_BAND, MSSP_CURVES_RUBBER_BAND_RANGE);
+
+/**
+ *  Fails to compile if the generation doesn't produce `MSSP_CURVES_TABLE_SIZE` samples.
+ */
+typedef char MSSPCurvesTableSizeCheck[(sizeof(g_easeInTable) / sizeof(g_easeInTable[0]) == MSSP_CURVES_TABLE_SIZE) ? 1 : -1];
+
+#pragma mark - Private functions
+
+/**
+ *  Clamp a progress between 0 and 1.
+ *
+ *  @param progress The progress.
+ *
+ *  @return The clamped progress.
+ */
+static double MSSPCurvesClampProgress(double progress)
+{
+    if (progress < 0)
+        return (0);
+    else if (progress > 1)
+        return (1);
+    
+    return (progress);
+}
+
+/**
+ *  Interpolate linearly a lookup table.
+ *
+ *  @param table    The table. It must contain `MSSP_CURVES_TABLE_SIZE` samples.
+ *  @param progress The position in the table, between 0 and 1.
+ *
+ *  @return The interpolated value.
+ */
+static double MSSPCurvesInterpolate(const double *table, double progress)
+{
+    double  position;
+    int     index;
+    
+    position = progress * (MSSP_CURVES_TABLE_SIZE - 1);
+    index = (int)position;
+    
+    if (index >= MSSP_CURVES_TABLE_SIZE - 1)
+        return (table[MSSP_CURVES_TABLE_SIZE - 1]);
+    
+    return (table[index] + (table[index + 1] - table[index]) * (position - index));
+}
+
+#pragma mark - Functions
+
+double MSSPCurveEvaluate(MSSPCurve curve, double progress)
+{
+    progress = MSSPCurvesClampProgress(progress);
+    
+    switch (curve)
+    {
+        case MSSPCurveEaseIn:
+            return (MSSPCurvesInterpolate(g_easeInTable, progress));
+        case MSSPCurveEaseOut:
+            return (MSSPCurvesInterpolate(g_easeOutTable, progress));
+        case MSSPCurveEaseInOut:
+            return (MSSPCurvesInterpolate(g_easeInOutTable, progress));
+        case MSSPCurveDecelerate:
+            return (MSSPCurvesInterpolate(g_decelerateTable, progress));
+        default:
+            return (progress);
+    }
+}
+
+double MSSPCurveEvaluateDirect(MSSPCurve curve, double progress)
+{
+    progress = MSSPCurvesClampProgress(progress);
+    
+    switch (curve)
+    {
+        case MSSPCurveEaseIn:
+            return (MSSP_CURVES_EASE_IN(progress));
+        case MSSPCurveEaseOut:
+            return (MSSP_CURVES_EASE_OUT(progress));
+        case MSSPCurveEaseInOut:
+            return (MSSP_CURVES_EASE_IN_OUT(progress));
+        case MSSPCurveDecelerate:
+            return (MSSP_CURVES_DECELERATE(progress));
+        default:
+            return (progress);
+    }
+}
+
+double MSSPCurvesRubberBand(double overscroll, double dimension)
+{
+    double  distance;
+    double  ratio;
+    
+    ratio = (overscroll < 0 ? -overscroll : overscroll) / dimension;
+    
+    if (ratio >= MSSP_CURVES_RUBBER_BAND_RANGE)
+        return (MSSPCurvesRubberBandDirect(overscroll, dimension));
+    
+    distance = MSSPCurvesInterpolate(g_rubberBandTable, ratio / MSSP_CURVES_RUBBER_BAND_RANGE) * dimension;
+    
+    return (overscroll < 0 ? -distance : distance);
+}
+
+double MSSPCurvesRubberBandDirect(double overscroll, double dimension)
+{
+    double  distance;
+    double  ratio;
+    
+    ratio = (overscroll < 0 ? -overscroll : overscroll) / dimension;
+    distance = MSSP_CURVES_RUBBER_BAND(ratio) * dimension;
+    
+    return (overscroll < 0 ? -distance : distance);
+}
@@ -0,0 +1,136 @@
+//  MSSPCurves.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_CURVES_H
+#define MSSP_CURVES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  The number of samples of each lookup table. The tables are interpolated linearly between two samples.
+ */
+#define MSSP_CURVES_TABLE_SIZE              65
+
+/**
+ *  The maximum difference between an interpolated value of a curve and its exact value, as a fraction of the distance covered by the curve.
+ */
+#define MSSP_CURVES_MAXIMUM_ERROR           0.001
+
+/**
+ *  The resistance of the rubber band. The smaller it is, the harder it is to drag beyond the limit.
+ */
+#define MSSP_CURVES_RUBBER_BAND_COEFFICIENT 0.55
+
+/**
+ *  The overscroll, as a multiple of the dimension, covered by the rubber band lookup table. Beyond it, the rubber band is evaluated directly.
+ */
+#define MSSP_CURVES_RUBBER_BAND_RANGE       4
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate the timing curve of an animation.
+ */
+typedef enum
+{
+    /**
+     *  The progress is constant.
+     */
+    MSSPCurveLinear     = 0,
+    
+    /**
+     *  The progress begins slowly and accelerates (cubic).
+     */
+    MSSPCurveEaseIn     = 1,
+    
+    /**
+     *  The progress begins quickly and slows down (cubic).
+     */
+    MSSPCurveEaseOut    = 2,
+    
+    /**
+     *  The progress begins slowly, accelerates and slows down (cubic).
+     */
+    MSSPCurveEaseInOut  = 3,
+    
+    /**
+     *  The progress begins very quickly and slows down for a long time (quintic).
+     */
+    MSSPCurveDecelerate = 4,
+} MSSPCurve;
+
+#pragma mark - Functions
+
+/**
+ *  Evaluate a curve with its lookup table.
+ *
+ *  @param curve    The curve.
+ *  @param progress The progress of the time, between 0 and 1. It is clamped if needed.
+ *
+ *  @return The progress of the value, between 0 and 1. The difference with `MSSPCurveEvaluateDirect` is never greater than `MSSP_CURVES_MAXIMUM_ERROR`.
+ */
+double  MSSPCurveEvaluate(MSSPCurve curve, double progress);
+
+/**
+ *  Evaluate a curve with its formula.
+ *
+ *  @param curve    The curve.
+ *  @param progress The progress of the time, between 0 and 1. It is clamped if needed.
+ *
+ *  @return The progress of the value, between 0 and 1.
+ */
+double  MSSPCurveEvaluateDirect(MSSPCurve curve, double progress);
+
+/**
+ *  Returns the distance displayed for a distance dragged beyond a limit, with a rubber band resistance. It is evaluated with a lookup table.
+ *
+ *  @param overscroll The distance dragged beyond the limit. Its sign is kept.
+ *  @param dimension  The dimension of the dragged area. The displayed distance never reaches it. Must be greater than 0.
+ *
+ *  @return The displayed distance. The difference with `MSSPCurvesRubberBandDirect` is never greater than `MSSP_CURVES_MAXIMUM_ERROR` times the dimension.
+ */
+double  MSSPCurvesRubberBand(double overscroll, double dimension);
+
+/**
+ *  Returns the distance displayed for a distance dragged beyond a limit, with a rubber band resistance. It is evaluated with its formula.
+ *
+ *  @param overscroll The distance dragged beyond the limit. Its sign is kept.
+ *  @param dimension  The dimension of the dragged area. The displayed distance never reaches it. Must be greater than 0.
+ *
+ *  @return The displayed distance.
+ */
+double  MSSPCurvesRubberBandDirect(double overscroll, double dimension);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
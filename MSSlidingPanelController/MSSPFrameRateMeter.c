@@ -0,0 +1,125 @@
+//  MSSPFrameRateMeter.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+
+#include "MSSPFrameRateMeter.h"
+
+#pragma mark - Functions
+
+void MSSPFrameRateMeterInit(MSSPFrameRateMeter *meter)
+{
+    memset(meter, 0, sizeof(*meter));
+}
+
+void MSSPFrameRateMeterBegin(MSSPFrameRateMeter *meter, MSSPTransitionType type, double maximumFrameRate)
+{
+    MSSPFrameRateMeterInit(meter);
+    meter->running = 1;
+    meter->type = type;
+    meter->maximumFrameRate = maximumFrameRate;
+}
+
+void MSSPFrameRateMeterRecordFrame(MSSPFrameRateMeter *meter, double timestamp)
+{
+    if (!meter->running)
+        return ;
+    
+    if (meter->framesCount == 0)
+        meter->firstTimestamp = timestamp;
+    else if (timestamp - meter->lastTimestamp > meter->longestFrame)
+        meter->longestFrame = timestamp - meter->lastTimestamp;
+    
+    meter->lastTimestamp = timestamp;
+    meter->framesCount++;
+}
+
+int MSSPFrameRateMeterEnd(MSSPFrameRateMeter *meter, MSSPFrameRateReport *report)
+{
+    int filled;
+    
+    filled = (meter->running && meter->framesCount >= 2 && meter->lastTimestamp > meter->firstTimestamp);
+    
+    if (filled)
+    {
+        report->type = meter->type;
+        report->duration = meter->lastTimestamp - meter->firstTimestamp;
+        report->framesCount = meter->framesCount;
+        report->frameRate = (meter->framesCount - 1) / report->duration;
+        report->maximumFrameRate = meter->maximumFrameRate;
+        report->longestFrame = meter->longestFrame;
+    }
+    
+    MSSPFrameRateMeterInit(meter);
+    
+    return (filled);
+}
+
+MSSPFrameRateRange MSSPFrameRateRangeMake(double minimum, double maximum, double preferred)
+{
+    MSSPFrameRateRange  range;
+    
+    range.minimum = minimum;
+    range.maximum = maximum;
+    range.preferred = preferred;
+    
+    return (range);
+}
+
+MSSPFrameRateRange MSSPFrameRateRangeFit(MSSPFrameRateRange range, double maximumFrameRate)
+{
+    if (maximumFrameRate > 0)
+    {
+        if (range.maximum > maximumFrameRate)
+            range.maximum = maximumFrameRate;
+        
+        if (range.minimum > range.maximum)
+            range.minimum = range.maximum;
+    }
+    
+    if (range.preferred > range.maximum)
+        range.preferred = range.maximum;
+    else if (range.preferred < range.minimum)
+        range.preferred = range.minimum;
+    
+    return (range);
+}
+
+const char *MSSPTransitionTypeGetName(MSSPTransitionType type)
+{
+    switch (type)
+    {
+        case MSSPTransitionTypeInteractive:
+            return ("interactive");
+        case MSSPTransitionTypeSettle:
+            return ("settle");
+        case MSSPTransitionTypeProgrammatic:
+            return ("programmatic");
+        default:
+            return ("unknown");
+    }
+}
@@ -0,0 +1,239 @@
+//  MSSPFrameRateMeter.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_FRAME_RATE_METER_H
+#define MSSP_FRAME_RATE_METER_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  The number of values of `MSSPTransitionType`.
+ */
+#define MSSP_TRANSITION_TYPES_COUNT 3
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate what moves the center view.
+ */
+typedef enum
+{
+    /**
+     *  The center view follows a drag.
+     */
+    MSSPTransitionTypeInteractive   = 0,
+    
+    /**
+     *  The center view settles at the end of a drag.
+     */
+    MSSPTransitionTypeSettle        = 1,
+    
+    /**
+     *  A panel is opened or closed programmatically.
+     */
+    MSSPTransitionTypeProgrammatic  = 2,
+} MSSPTransitionType;
+
+#pragma mark - Structures
+
+/**
+ *  A range of frame rates, in frames per second.
+ */
+typedef struct
+{
+    /**
+     *  The minimum frame rate.
+     */
+    double  minimum;
+    
+    /**
+     *  The maximum frame rate.
+     */
+    double  maximum;
+    
+    /**
+     *  The preferred frame rate, between the minimum and the maximum.
+     */
+    double  preferred;
+} MSSPFrameRateRange;
+
+/**
+ *  The frame rate achieved by a transition.
+ */
+typedef struct
+{
+    /**
+     *  The type of the transition.
+     */
+    MSSPTransitionType  type;
+    
+    /**
+     *  The duration of the transition, in seconds, from its first frame to its last one.
+     */
+    double              duration;
+    
+    /**
+     *  The number of frames displayed with new content.
+     */
+    size_t              framesCount;
+    
+    /**
+     *  The average frame rate, in frames per second.
+     */
+    double              frameRate;
+    
+    /**
+     *  The maximum frame rate of the display, in frames per second.
+     */
+    double              maximumFrameRate;
+    
+    /**
+     *  The duration of the longest frame, in seconds.
+     */
+    double              longestFrame;
+} MSSPFrameRateReport;
+
+/**
+ *  The state of a frame rate meter. It must be initialized with `MSSPFrameRateMeterInit`.
+ *
+ *  The meter doesn't read the clock: the frames timestamps are given by the caller, in seconds.
+ */
+typedef struct
+{
+    /**
+     *  1 if a transition is measured, else 0.
+     */
+    int                 running;
+    
+    /**
+     *  The type of the measured transition.
+     */
+    MSSPTransitionType  type;
+    
+    /**
+     *  The maximum frame rate of the display.
+     */
+    double              maximumFrameRate;
+    
+    /**
+     *  The timestamp of the first frame.
+     */
+    double              firstTimestamp;
+    
+    /**
+     *  The timestamp of the last frame.
+     */
+    double              lastTimestamp;
+    
+    /**
+     *  The number of frames recorded.
+     */
+    size_t              framesCount;
+    
+    /**
+     *  The duration of the longest frame.
+     */
+    double              longestFrame;
+} MSSPFrameRateMeter;
+
+#pragma mark - Functions
+
+/**
+ *  Initialize a frame rate meter without measured transition.
+ *
+ *  @param meter The meter. Must not be `NULL`.
+ */
+void                MSSPFrameRateMeterInit(MSSPFrameRateMeter *meter);
+
+/**
+ *  Begin to measure a transition. The previous measure is dropped.
+ *
+ *  @param meter            The meter. Must not be `NULL`.
+ *  @param type             The type of the transition.
+ *  @param maximumFrameRate The maximum frame rate of the display, in frames per second.
+ */
+void                MSSPFrameRateMeterBegin(MSSPFrameRateMeter *meter, MSSPTransitionType type, double maximumFrameRate);
+
+/**
+ *  Record a displayed frame. Does nothing if no transition is measured.
+ *
+ *  @param meter     The meter. Must not be `NULL`.
+ *  @param timestamp The timestamp of the frame, in seconds.
+ */
+void                MSSPFrameRateMeterRecordFrame(MSSPFrameRateMeter *meter, double timestamp);
+
+/**
+ *  End the measure of a transition.
+ *
+ *  @param meter  The meter. Must not be `NULL`.
+ *  @param report Filled with the frame rate achieved by the transition. Must not be `NULL`.
+ *
+ *  @return 1 if the report has been filled, 0 if no transition was measured or if it lasted less than two frames.
+ */
+int                 MSSPFrameRateMeterEnd(MSSPFrameRateMeter *meter, MSSPFrameRateReport *report);
+
+/**
+ *  Return a frame rate range.
+ *
+ *  @param minimum   The minimum frame rate.
+ *  @param maximum   The maximum frame rate.
+ *  @param preferred The preferred frame rate.
+ *
+ *  @return The range.
+ */
+MSSPFrameRateRange  MSSPFrameRateRangeMake(double minimum, double maximum, double preferred);
+
+/**
+ *  Fit a frame rate range to a display: the frame rates are limited to its maximum frame rate and the preferred one is kept between the minimum and the maximum.
+ *
+ *  @param range            The range.
+ *  @param maximumFrameRate The maximum frame rate of the display, in frames per second.
+ *
+ *  @return The fitted range.
+ */
+MSSPFrameRateRange  MSSPFrameRateRangeFit(MSSPFrameRateRange range, double maximumFrameRate);
+
+/**
+ *  Return the name of a transition type.
+ *
+ *  @param type The type.
+ *
+ *  @return The name.
+ */
+const char          *MSSPTransitionTypeGetName(MSSPTransitionType type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
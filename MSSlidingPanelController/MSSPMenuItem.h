@@ -0,0 +1,105 @@
+//  MSSPMenuItem.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <Foundation/Foundation.h>
+
+#pragma mark - Interface
+
+/**
+ *  The `MSSPMenuItem` class corresponds to an item of a menu. It indicates the name of the item and if this one is checked.
+ */
+@interface MSSPMenuItem : NSObject <NSCopying>
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return a checkable `MSSPMenuItem` object.
+ *
+ *  @param name The item's name. It must not be `nil`.
+ *
+ *  @return The `MSSPMenuItem` object.
+ */
++ (MSSPMenuItem *)menuItemCheckableWithName:(NSString *)name;
+
+/**
+ *  Create and return a uncheckable `MSSPMenuItem` object.
+ *
+ *  @param name The item's name. It must not be `nil`.
+ *
+ *  @return The `MSSPMenuItem` object.
+ */
++ (MSSPMenuItem *)menuItemUncheckableWithName:(NSString *)name;
+
+#pragma mark Item properties
+/** @name Item properties */
+
+/**
+ *  Action to execute when the item is deselected.
+ */
+@property (nonatomic, copy)             void        (^actionWhenDeselected)(void);
+
+/**
+ *  Action to execute when the item is selected.
+ */
+@property (nonatomic, copy)             void        (^actionWhenSelected)(void);
+
+/**
+ *  Indicate if the item is checked.
+ *  The default value is "NO".
+ */
+@property (nonatomic, assign)           BOOL        checked;
+
+/**
+ *  The identifier which allows to follow the item from a version of the menu to the next one. It must be unique in its section.
+ *  By default, it is the item's name.
+ */
+@property (nonatomic, strong)           NSString    *identifier;
+
+/**
+ *  Indicate if the item is checkable.
+ */
+@property (nonatomic, assign, readonly) BOOL        isCheckable;
+
+/**
+ *  The item's name.
+ */
+@property (nonatomic, strong)           NSString    *name;
+
+#pragma mark Compare items
+/** @name Compare items */
+
+/**
+ *  Indicate if an item is displayed the same way as the receiver: same name, same checked state and same checkability.
+ *
+ *  @param item The item.
+ *
+ *  @return YES if the item is displayed the same way, else NO.
+ */
+- (BOOL)isDisplayedLikeItem:(MSSPMenuItem *)item;
+
+@end
@@ -0,0 +1,156 @@
+//  MSSPMenuItem.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import "MSSPMenuItem.h"
+
+#pragma mark - Interface
+
+@interface MSSPMenuItem ()
+
+#pragma mark Item properties
+/** @name Item properties */
+
+/**
+ *  Indicate if the item is checkable.
+ */
+@property (nonatomic, assign)   BOOL    isCheckable;
+
+@end
+
+#pragma mark - Implementation
+
+@implementation MSSPMenuItem
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return a `MSSPMenuItem` object.
+ *
+ *  @return The `MSSPMenuItem` object.
+ */
+- (id)init
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self setName:@""];
+        [self setIdentifier:nil];
+        [self setIsCheckable:NO];
+        [self setChecked:NO];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Create and return a checkable `MSSPMenuItem` object.
+ *
+ *  @param name The item's name. It must not be `nil`.
+ *
+ *  @return The `MSSPMenuItem` object.
+ */
++ (MSSPMenuItem *)menuItemCheckableWithName:(NSString *)name
+{
+    MSSPMenuItem    *item;
+    
+    NSParameterAssert(name);
+    
+    item = [[MSSPMenuItem alloc] init];
+    [item setName:name];
+    [item setIsCheckable:YES];
+    
+    return (item);
+}
+
+/**
+ *  Create and return a uncheckable `MSSPMenuItem` object.
+ *
+ *  @param name The item's name. It must not be `nil`.
+ *
+ *  @return The `MSSPMenuItem` object.
+ */
++ (MSSPMenuItem *)menuItemUncheckableWithName:(NSString *)name
+{
+    MSSPMenuItem    *item;
+    
+    NSParameterAssert(name);
+    
+    item = [[MSSPMenuItem alloc] init];
+    [item setName:name];
+    
+    return (item);
+}
+
+#pragma mark Item properties
+/** @name Item properties */
+
+/**
+ *  The identifier which allows to follow the item from a version of the menu to the next one.
+ *
+ *  @return The identifier, or the name if no identifier has been set.
+ */
+- (NSString *)identifier
+{
+    return (_identifier ? _identifier : [self name]);
+}
+
+#pragma mark Compare items
+/** @name Compare items */
+
+/**
+ *  Indicate if an item is displayed the same way as the receiver: same name, same checked state and same checkability.
+ *
+ *  @param item The item.
+ *
+ *  @return YES if the item is displayed the same way, else NO.
+ */
+- (BOOL)isDisplayedLikeItem:(MSSPMenuItem *)item
+{
+    return ([item checked] == [self checked] && [item isCheckable] == [self isCheckable] && [[item name] isEqualToString:[self name]]);
+}
+
+#pragma mark Copy
+/** @name Copy */
+
+- (id)copyWithZone:(NSZone *)__unused zone
+{
+    MSSPMenuItem    *item;
+    
+    item = [[MSSPMenuItem alloc] init];
+    [item setActionWhenDeselected:[self actionWhenDeselected]];
+    [item setActionWhenSelected:[self actionWhenSelected]];
+    [item setChecked:[self checked]];
+    [item setIdentifier:_identifier];
+    [item setIsCheckable:[self isCheckable]];
+    [item setName:[self name]];
+    
+    return (item);
+}
+
+@end
@@ -0,0 +1,130 @@
+//  MSSPMenuSection.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <Foundation/Foundation.h>
+
+#import "MSSPMenuItem.h"
+
+#pragma mark - Enumeration
+
+/**
+ *  An enumeration for the different rules of selection of a menu section.
+ */
+typedef NS_ENUM(NSInteger, MSSPMenuSelectionRule)
+{
+    /**
+     *  Nobody can be selected.
+     */
+    MSSPMenuSelectionRuleNone,
+    
+    /**
+     *  Only one item of the section can be selected.
+     */
+    MSSPMenuSelectionRuleOnlyOne,
+    
+    /**
+     *  Several items of the section can be selected simultaneously.
+     */
+    MSSPMenuSelectionRuleMultiple,
+};
+
+#pragma mark - Interface
+
+/**
+ *  The `MSSPMenuSection` class corresponds to a section of a menu. It indicates the name of the section and the list of its items.
+ */
+@interface MSSPMenuSection : NSObject <NSCopying>
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return a `MSSPMenuSection` object.
+ *
+ *  @param name          The section's name. It must not be `nil`.
+ *  @param selectionRule The section's selection rule.
+ *  @param items         An array of `MSSPMenuItem` objects. The incompatible items will dropped.
+ *
+ *  @return The `MSSPMenuSection` object.
+ */
++ (MSSPMenuSection *)menuSectionWithName:(NSString *)name selectionRule:(MSSPMenuSelectionRule)selectionRule andItems:(NSArray *)items;
+
+#pragma mark Section information
+/** @name Section information */
+
+/**
+ *  The identifier which allows to follow the section from a version of the menu to the next one. It must be unique in the menu.
+ *  By default, it is the section's name.
+ */
+@property (nonatomic, strong)           NSString                *identifier;
+
+/**
+ *  The section's name.
+ */
+@property (nonatomic, strong)           NSString                *name;
+
+/**
+ *  The section's selection rule.
+ */
+@property (nonatomic, assign, readonly) MSSPMenuSelectionRule   selectionRule;
+
+#pragma mark Manage items
+/** @name Manage items */
+
+/**
+ *  Return a copy of the item at the index.
+ *
+ *  @param index The index.
+ *
+ *  @return A copy of the item. Is nil if the index is out of bounds.
+ */
+- (MSSPMenuItem *)itemAtIndex:(NSUInteger)index;
+
+/**
+ *  If the selection rule is MSSPMenuSelectionRuleOnlyOne, the index of item currently selected.
+ */
+@property (nonatomic, assign, readonly) NSUInteger              itemSelectedIndex;
+
+/**
+ *  Return the number of item in the section.
+ *
+ *  @return The number of item.
+ */
+- (NSUInteger)numberOfItems;
+
+/**
+ *  Select an item.
+ *
+ *  If the selection rule is set to MSSPMenuSelectionRuleNone, the selected action of the item will be called.
+ *  If the selection rule is set to MSSPMenuSelectionRuleOnlyOne, the new item will be checked and the others will be unchecked. The corresponding actions will also be called.
+ *  If the selection rule is set to MSSPMenuSelectionRuleMultiple, the new item will be checked / unchecked and the corresponding action will be called.
+ *
+ *  @param index The index.
+ */
+- (void)selectItemAtIndex:(NSUInteger)index;
+
+@end
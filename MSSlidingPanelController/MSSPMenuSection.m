@@ -0,0 +1,252 @@
+//  MSSPMenuSection.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import "MSSPMenuSection.h"
+
+#pragma mark - Interface
+
+@interface MSSPMenuSection ()
+
+#pragma mark Items
+/** @name Items */
+
+/**
+ *  The section's items.
+ */
+@property (nonatomic, strong)   NSMutableArray          *items;
+
+/**
+ *  If the selection rule is MSSPMenuSelectionRuleOnlyOne, the item currently selected.
+ */
+@property (nonatomic, weak)     MSSPMenuItem            *itemSelected;
+
+/**
+ *  If the selection rule is MSSPMenuSelectionRuleOnlyOne, the index of item currently selected.
+ */
+@property (nonatomic, assign)   NSUInteger              itemSelectedIndex;
+
+#pragma mark Section information
+/** @name Section information */
+
+/**
+ *  The section's selection rule.
+ */
+@property (nonatomic, assign)   MSSPMenuSelectionRule   selectionRule;
+
+@end
+
+#pragma mark - Implementation
+
+@implementation MSSPMenuSection
+
+#pragma mark Initialization
+/** @name Initialization */
+
+- (id)init
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self setName:@""];
+        [self setIdentifier:nil];
+        [self setSelectionRule:MSSPMenuSelectionRuleNone];
+        [self setItemSelected:nil];
+        [self setItemSelectedIndex:0];
+        [self setItems:[[NSMutableArray alloc] init]];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Create and return a `MSSPMenuSection` object.
+ *
+ *  @param name          The section's name. It must not be `nil`.
+ *  @param selectionRule The section's selection rule.
+ *  @param items         An array of `MSSPMenuItem` objects. The incompatible items will dropped.
+ *
+ *  @return The `MSSPMenuSection` object.
+ */
++ (MSSPMenuSection *)menuSectionWithName:(NSString *)name selectionRule:(MSSPMenuSelectionRule)selectionRule andItems:(NSArray *)items
+{
+    MSSPMenuItem    *item;
+    MSSPMenuSection *section;
+    
+    NSParameterAssert(name);
+    
+    section = [[MSSPMenuSection alloc] init];
+    [section setName:name];
+    [section setSelectionRule:selectionRule];
+    
+    for (item in items)
+    {
+        if (([section selectionRule] == MSSPMenuSelectionRuleNone && ![item isCheckable]) ||
+            ([section selectionRule] != MSSPMenuSelectionRuleNone && [item isCheckable]))
+        {
+            if ([section selectionRule] == MSSPMenuSelectionRuleOnlyOne && [item checked])
+            {
+                if ([section itemSelected])
+                    [[section itemSelected] setChecked:NO];
+                
+                [section setItemSelected:item];
+                [section setItemSelectedIndex:[section numberOfItems]];
+            }
+            
+            [[section items] addObject:item];
+        }
+    }
+    
+    if ([section selectionRule] == MSSPMenuSelectionRuleOnlyOne && ![section itemSelected] && [section numberOfItems] > 0)
+    {
+        [section setItemSelected:[[section items] objectAtIndex:0]];
+        [section setItemSelectedIndex:0];
+        [[section itemSelected] setChecked:YES];
+    }
+    
+    return (section);
+}
+
+#pragma mark Section information
+/** @name Section information */
+
+/**
+ *  The identifier which allows to follow the section from a version of the menu to the next one.
+ *
+ *  @return The identifier, or the name if no identifier has been set.
+ */
+- (NSString *)identifier
+{
+    return (_identifier ? _identifier : [self name]);
+}
+
+#pragma mark Manage items
+/** @name Manage items */
+
+/**
+ *  Return a copy of the item at the index.
+ *
+ *  @param index The index.
+ *
+ *  @return A copy of the item. Is nil if the index is out of bounds.
+ */
+- (MSSPMenuItem *)itemAtIndex:(NSUInteger)index
+{
+    if (index >= [self numberOfItems])
+        return (nil);
+    
+    return ([[[self items] objectAtIndex:index] copy]);
+}
+
+/**
+ *  Return the number of item in the section.
+ *
+ *  @return The number of item.
+ */
+- (NSUInteger)numberOfItems
+{
+    return ([[self items] count]);
+}
+
+/**
+ *  Select an item.
+ *
+ *  If the selection rule is set to MSSPMenuSelectionRuleNone, the selected action of the item will be called.
+ *  If the selection rule is set to MSSPMenuSelectionRuleOnlyOne, the new item will be checked and the others will be unchecked. The corresponding actions will also be called.
+ *  If the selection rule is set to MSSPMenuSelectionRuleMultiple, the new item will be checked / unchecked and the corresponding action will be called.
+ *
+ *  @param index The index.
+ */
+- (void)selectItemAtIndex:(NSUInteger)index
+{
+    MSSPMenuItem    *item;
+    
+    if (index >= [self numberOfItems])
+        return ;
+    
+    item = [[self items] objectAtIndex:index];
+    
+    if ([self selectionRule] == MSSPMenuSelectionRuleNone)
+    {
+        if ([item actionWhenSelected])
+            [item actionWhenSelected]();
+    }
+    else if ([self selectionRule] == MSSPMenuSelectionRuleOnlyOne)
+    {
+        if ([item checked])
+            return ;
+        
+        if ([self itemSelected])
+        {
+            [[self itemSelected] setChecked:NO];
+            
+            if ([[self itemSelected] actionWhenDeselected])
+                [[self itemSelected] actionWhenDeselected]();
+        }
+        
+        [item setChecked:YES];
+        [self setItemSelected:item];
+        [self setItemSelectedIndex:index];
+        
+        if ([item actionWhenSelected])
+            [item actionWhenSelected]();
+    }
+    else
+    {
+        [item setChecked:![item checked]];
+        
+        if ([item checked] && [item actionWhenSelected])
+            [item actionWhenSelected]();
+        else if (![item checked] && [item actionWhenDeselected])
+            [item actionWhenDeselected]();
+    }
+}
+
+#pragma mark Copy
+/** @name Copy */
+
+- (id)copyWithZone:(NSZone *)__unused zone
+{
+    MSSPMenuItem    *item;
+    MSSPMenuSection *section;
+    
+    section = [[MSSPMenuSection alloc] init];
+    [section setIdentifier:_identifier];
+    [section setName:[self name]];
+    [section setSelectionRule:[self selectionRule]];
+    [section setItemSelectedIndex:[self itemSelectedIndex]];
+    
+    for (item in [self items])
+        [[section items] addObject:[item copy]];
+    
+    if ([self itemSelected])
+        [section setItemSelected:[[section items] objectAtIndex:[self itemSelectedIndex]]];
+    
+    return (section);
+}
+
+@end
@@ -0,0 +1,103 @@
+//  MSSPPanTracker.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+
+#include "MSSPPanTracker.h"
+
+#pragma mark - Functions
+
+void MSSPPanTrackerInit(MSSPPanTracker *tracker)
+{
+    memset(tracker, 0, sizeof(*tracker));
+}
+
+int MSSPPanTrackerCanClaimTouch(const MSSPPanTracker *tracker, uintptr_t touch)
+{
+    return (tracker->touch == 0 || tracker->touch == touch);
+}
+
+int MSSPPanTrackerClaimTouch(MSSPPanTracker *tracker, uintptr_t touch)
+{
+    if (!MSSPPanTrackerCanClaimTouch(tracker, touch))
+        return (0);
+    
+    tracker->touch = touch;
+    
+    return (1);
+}
+
+void MSSPPanTrackerReleaseTouch(MSSPPanTracker *tracker)
+{
+    if (!tracker->tracking)
+        tracker->touch = 0;
+}
+
+void MSSPPanTrackerBegin(MSSPPanTracker *tracker, const MSSPPanelEngine *engine, uintptr_t window, double originX, int direction)
+{
+    tracker->window = window;
+    tracker->translationX = 0;
+    tracker->beginSide = MSSPPanelEngineSnap(engine, originX, direction);
+    tracker->tracking = 1;
+}
+
+int MSSPPanTrackerIsInWindow(const MSSPPanTracker *tracker, uintptr_t window)
+{
+    return (!tracker->tracking || tracker->window == window);
+}
+
+double MSSPPanTrackerMove(MSSPPanTracker *tracker, double translationX)
+{
+    double  delta;
+    
+    delta = translationX - tracker->translationX;
+    tracker->translationX = translationX;
+    
+    return (delta);
+}
+
+void MSSPPanTrackerRebase(MSSPPanTracker *tracker, double translationX)
+{
+    tracker->translationX = translationX;
+}
+
+int MSSPPanTrackerEnd(MSSPPanTracker *tracker, const MSSPPanelEngine *engine, double originX, int direction, MSSPPanEnding ending)
+{
+    int side;
+    
+    if (ending == MSSPPanEndingCompleted)
+        side = MSSPPanelEngineSnap(engine, originX, direction);
+    else
+        side = tracker->beginSide;
+    
+    if ((side > 0 && !engine->hasLeftPanel) || (side < 0 && !engine->hasRightPanel))
+        side = 0;
+    
+    MSSPPanTrackerInit(tracker);
+    
+    return (side);
+}
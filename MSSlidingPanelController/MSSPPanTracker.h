@@ -0,0 +1,191 @@
+//  MSSPPanTracker.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_PAN_TRACKER_H
+#define MSSP_PAN_TRACKER_H
+
+#include <stdint.h>
+
+#include "MSSPPanelEngine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate how a pan ends.
+ */
+typedef enum
+{
+    /**
+     *  The finger has been lifted.
+     */
+    MSSPPanEndingCompleted  = 0,
+    
+    /**
+     *  The pan has been cancelled by the system: incoming call, alert, move to another window...
+     */
+    MSSPPanEndingCancelled  = 1,
+    
+    /**
+     *  The pan has failed.
+     */
+    MSSPPanEndingFailed     = 2,
+} MSSPPanEnding;
+
+#pragma mark - Structures
+
+/**
+ *  The state of a pan tracker. It must be initialized with `MSSPPanTrackerInit`.
+ *
+ *  A tracker gives the ownership of a pan to a single touch, follows its translation and decides where the center view settles whatever the way the pan ends.
+ *  Touches and windows are opaque identifiers given by the caller; 0 means none.
+ */
+typedef struct
+{
+    /**
+     *  The touch which owns the pan.
+     */
+    uintptr_t   touch;
+    
+    /**
+     *  The window in which the pan began.
+     */
+    uintptr_t   window;
+    
+    /**
+     *  The horizontal translation already applied to the center view, in points.
+     */
+    double      translationX;
+    
+    /**
+     *  The side displayed when the pan began: 1 for the left panel, -1 for the right one, else 0.
+     */
+    int         beginSide;
+    
+    /**
+     *  1 if a pan is running, else 0.
+     */
+    int         tracking;
+} MSSPPanTracker;
+
+#pragma mark - Functions
+
+/**
+ *  Initialize a pan tracker without owner nor running pan.
+ *
+ *  @param tracker The tracker. Must not be `NULL`.
+ */
+void    MSSPPanTrackerInit(MSSPPanTracker *tracker);
+
+/**
+ *  Indicate if a touch can own the pan, without giving it the ownership.
+ *
+ *  @param tracker The tracker. Must not be `NULL`.
+ *  @param touch   The touch.
+ *
+ *  @return 1 if the pan is not owned by another touch, else 0.
+ */
+int     MSSPPanTrackerCanClaimTouch(const MSSPPanTracker *tracker, uintptr_t touch);
+
+/**
+ *  Give the ownership of the pan to a touch, if it is not owned by another one.
+ *
+ *  @param tracker The tracker. Must not be `NULL`.
+ *  @param touch   The touch.
+ *
+ *  @return 1 if the touch owns the pan, else 0.
+ */
+int     MSSPPanTrackerClaimTouch(MSSPPanTracker *tracker, uintptr_t touch);
+
+/**
+ *  Release the ownership of the pan. Must be used when the owning touch ends without having began a pan.
+ *
+ *  @param tracker The tracker. Must not be `NULL`.
+ */
+void    MSSPPanTrackerReleaseTouch(MSSPPanTracker *tracker);
+
+/**
+ *  Tell that a pan begins.
+ *
+ *  @param tracker   The tracker. Must not be `NULL`.
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param window    The window of the sliding panel controller.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ */
+void    MSSPPanTrackerBegin(MSSPPanTracker *tracker, const MSSPPanelEngine *engine, uintptr_t window, double originX, int direction);
+
+/**
+ *  Indicate if the running pan can go on in a window.
+ *
+ *  @param tracker The tracker. Must not be `NULL`.
+ *  @param window  The current window of the sliding panel controller.
+ *
+ *  @return 1 if no pan is running or if it began in this window, else 0.
+ */
+int     MSSPPanTrackerIsInWindow(const MSSPPanTracker *tracker, uintptr_t window);
+
+/**
+ *  Tell that the pan moves.
+ *
+ *  @param tracker      The tracker. Must not be `NULL`.
+ *  @param translationX The horizontal translation of the pan since its beginning, in points.
+ *
+ *  @return The horizontal translation since the last move, in points.
+ */
+double  MSSPPanTrackerMove(MSSPPanTracker *tracker, double translationX);
+
+/**
+ *  Consider a translation as already applied, without move.
+ *
+ *  @param tracker      The tracker. Must not be `NULL`.
+ *  @param translationX The horizontal translation of the pan since its beginning, in points.
+ */
+void    MSSPPanTrackerRebase(MSSPPanTracker *tracker, double translationX);
+
+/**
+ *  Tell that the pan ends, release its ownership and decide where the center view settles.
+ *  A completed pan settles on the nearest side, a cancelled or failed one goes back to the side displayed when it began.
+ *
+ *  @param tracker   The tracker. Must not be `NULL`.
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *  @param ending    The way the pan ends.
+ *
+ *  @return The side to display: 1 for the left panel, -1 for the right one, else 0.
+ */
+int     MSSPPanTrackerEnd(MSSPPanTracker *tracker, const MSSPPanelEngine *engine, double originX, int direction, MSSPPanEnding ending);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,192 @@
+//  MSSPPanelEngine.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <math.h>
+
+#include "MSSPPanelEngine.h"
+
+#pragma mark - Macros
+
+#define MSSP_PANEL_ENGINE_PI    3.14159265358979323846
+
+#pragma mark - Private functions
+
+/**
+ *  Return the maximum width of the displayed panel.
+ *
+ *  @param engine    The engine.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *
+ *  @return The width. Is 0 if no panel is displayed.
+ */
+static double MSSPPanelEngineWidth(const MSSPPanelEngine *engine, int direction)
+{
+    if (direction > 0)
+        return (engine->leftPanelWidth);
+    else if (direction < 0)
+        return (engine->rightPanelWidth);
+    
+    return (0);
+}
+
+#pragma mark - Functions
+
+int MSSPPanelEngineIsPanHorizontal(double x, double y, double lockAngle)
+{
+    return (fabs(y) <= fabs(x) * tan(lockAngle * MSSP_PANEL_ENGINE_PI / 180));
+}
+
+void MSSPPanelEngineClamp(const MSSPPanelEngine *engine, double originX, int direction, MSSPPanelClamp *clamp)
+{
+    double  limit;
+    double  overscroll;
+    
+    clamp->overscrollTranslation = 0;
+    clamp->hysteresisTranslation = 0;
+    
+    if (engine->hasLeftPanel && originX > engine->leftPanelWidth)
+    {
+        limit = engine->leftPanelWidth;
+        
+        if (engine->rubberBandEnabled && limit > 0)
+        {
+            overscroll = MSSPCurvesRubberBand(originX - limit, limit);
+            clamp->overscrollTranslation = originX - limit - overscroll;
+            limit += overscroll;
+        }
+        
+        originX = limit;
+    }
+    else if (!engine->hasLeftPanel && originX > 0)
+        originX = 0;
+    
+    if (engine->hasRightPanel && originX < -engine->rightPanelWidth)
+    {
+        limit = -engine->rightPanelWidth;
+        
+        if (engine->rubberBandEnabled && limit < 0)
+        {
+            overscroll = MSSPCurvesRubberBand(originX - limit, -limit);
+            clamp->overscrollTranslation = originX - limit - overscroll;
+            limit += overscroll;
+        }
+        
+        originX = limit;
+    }
+    else if (!engine->hasRightPanel && originX < 0)
+        originX = 0;
+    
+    if ((direction < 0 && originX > 0 && originX < engine->switchHysteresis) ||
+        (direction > 0 && originX < 0 && originX > -engine->switchHysteresis))
+    {
+        clamp->hysteresisTranslation = originX;
+        originX = 0;
+    }
+    
+    clamp->originX = originX;
+}
+
+int MSSPPanelEngineSnap(const MSSPPanelEngine *engine, double originX, int direction)
+{
+    if (direction > 0)
+        return (originX <= engine->leftPanelWidth / 2 ? 0 : 1);
+    else if (direction < 0)
+        return (originX >= -engine->rightPanelWidth / 2 ? 0 : -1);
+    
+    return (0);
+}
+
+double MSSPPanelEngineFraction(const MSSPPanelEngine *engine, double originX, int direction)
+{
+    double  width;
+    
+    width = MSSPPanelEngineWidth(engine, direction);
+    
+    if (width <= 0)
+        return (0);
+    
+    return (direction * originX / width);
+}
+
+void MSSPPanelEngineRevealInput(const MSSPPanelEngine *engine, double originX, int direction, MSSPRevealInput *input)
+{
+    double  fraction;
+    
+    fraction = MSSPPanelEngineFraction(engine, originX, direction);
+    
+    input->distance = originX;
+    input->direction = (direction > 0 ? 1 : (direction < 0 ? -1 : 0));
+    input->panelWidth = MSSPPanelEngineWidth(engine, direction);
+    input->fraction = (fraction < 0 ? 0 : (fraction > 1 ? 1 : fraction));
+}
+
+MSSPColorComponents MSSPPanelEngineStatusBarColor(const MSSPPanelEngine *engine, double originX, int direction)
+{
+    if (direction > 0 && engine->leftStatusBarBlended)
+        return (MSSPColorComponentsBlend(engine->centerStatusBarColor, engine->leftStatusBarColor, MSSPPanelEngineFraction(engine, originX, direction)));
+    else if (direction > 0)
+        return (engine->leftStatusBarColor);
+    else if (direction < 0 && engine->rightStatusBarBlended)
+        return (MSSPColorComponentsBlend(engine->centerStatusBarColor, engine->rightStatusBarColor, MSSPPanelEngineFraction(engine, originX, direction)));
+    else if (direction < 0)
+        return (engine->rightStatusBarColor);
+    
+    return (engine->centerStatusBarColor);
+}
+
+void MSSPPanelEngineEvaluateProgress(const MSSPPanelEngine *engine, double originX, int direction, MSSPPanelProgress *progress)
+{
+    MSSPRevealInput input;
+    
+    MSSPPanelEngineRevealInput(engine, originX, direction, &input);
+    MSSPRevealStyleEvaluate(engine->revealStyleEvaluator, &input, &progress->reveal);
+    
+    progress->fraction = MSSPPanelEngineFraction(engine, originX, direction);
+    progress->statusBarColor = MSSPPanelEngineStatusBarColor(engine, originX, direction);
+}
+
+double MSSPPanelEngineAnimationDuration(double length, double velocity)
+{
+    return (fabs(length) / velocity);
+}
+
+double MSSPPanelEngineAnimationOriginX(MSSPCurve curve, double fromX, double toX, double progress)
+{
+    return (fromX + (toX - fromX) * MSSPCurveEvaluate(curve, progress));
+}
+
+MSSPColorComponents MSSPColorComponentsBlend(MSSPColorComponents from, MSSPColorComponents to, double fraction)
+{
+    MSSPColorComponents color;
+    
+    color.red = from.red + (to.red - from.red) * fraction;
+    color.green = from.green + (to.green - from.green) * fraction;
+    color.blue = from.blue + (to.blue - from.blue) * fraction;
+    color.alpha = from.alpha + (to.alpha - from.alpha) * fraction;
+    
+    return (color);
+}
@@ -0,0 +1,272 @@
+//  MSSPPanelEngine.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_PANEL_ENGINE_H
+#define MSSP_PANEL_ENGINE_H
+
+#include "MSSPCurves.h"
+#include "MSSPRevealStyle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Structures
+
+/**
+ *  The components of a color, between 0 and 1.
+ */
+typedef struct
+{
+    double  red;
+    double  green;
+    double  blue;
+    double  alpha;
+} MSSPColorComponents;
+
+/**
+ *  The settings of a sliding panel controller needed to compute the positions and the effects of a slide, without UIKit.
+ */
+typedef struct
+{
+    /**
+     *  The maximum width of the left panel, in points.
+     */
+    double                      leftPanelWidth;
+    
+    /**
+     *  The maximum width of the right panel, in points.
+     */
+    double                      rightPanelWidth;
+    
+    /**
+     *  1 if there is a left panel, else 0.
+     */
+    int                         hasLeftPanel;
+    
+    /**
+     *  1 if there is a right panel, else 0.
+     */
+    int                         hasRightPanel;
+    
+    /**
+     *  1 if the center view can be dragged beyond the maximum width of a panel with a rubber band resistance, else 0.
+     */
+    int                         rubberBandEnabled;
+    
+    /**
+     *  The distance, in points, the center view must be dragged past its closed position before the opposite panel is revealed.
+     */
+    double                      switchHysteresis;
+    
+    /**
+     *  The color of the status bar when no panel is displayed.
+     */
+    MSSPColorComponents         centerStatusBarColor;
+    
+    /**
+     *  The color of the status bar when the left panel is displayed.
+     */
+    MSSPColorComponents         leftStatusBarColor;
+    
+    /**
+     *  The color of the status bar when the right panel is displayed.
+     */
+    MSSPColorComponents         rightStatusBarColor;
+    
+    /**
+     *  1 if the status bar color is blended while the left panel is revealed, else 0.
+     */
+    int                         leftStatusBarBlended;
+    
+    /**
+     *  1 if the status bar color is blended while the right panel is revealed, else 0.
+     */
+    int                         rightStatusBarBlended;
+    
+    /**
+     *  The function which evaluates the reveal style.
+     */
+    MSSPRevealStyleEvaluator    revealStyleEvaluator;
+} MSSPPanelEngine;
+
+/**
+ *  The horizontal position of the center view once a pan step has been clamped.
+ */
+typedef struct
+{
+    /**
+     *  The clamped position, in points.
+     */
+    double  originX;
+    
+    /**
+     *  The part of the pan translation absorbed by the rubber band, which must be added to the next pan step.
+     */
+    double  overscrollTranslation;
+    
+    /**
+     *  The part of the pan translation absorbed by the switch hysteresis, which must be added to the next pan step.
+     */
+    double  hysteresisTranslation;
+} MSSPPanelClamp;
+
+/**
+ *  Everything which follows the position of the center view.
+ */
+typedef struct
+{
+    /**
+     *  The visible part of the displayed panel. It is greater than 1 when the center view is dragged beyond the maximum width.
+     */
+    double                  fraction;
+    
+    /**
+     *  The parameters of the reveal style.
+     */
+    MSSPRevealParameters    reveal;
+    
+    /**
+     *  The color of the status bar.
+     */
+    MSSPColorComponents     statusBarColor;
+} MSSPPanelProgress;
+
+#pragma mark - Functions
+
+/**
+ *  Indicate if a pan is horizontal enough to slide the center view.
+ *
+ *  @param x         The horizontal velocity or translation of the pan.
+ *  @param y         The vertical velocity or translation of the pan.
+ *  @param lockAngle The maximum angle between the pan and the horizontal axis, in degrees.
+ *
+ *  @return 1 if the pan is horizontal, else 0.
+ */
+int     MSSPPanelEngineIsPanHorizontal(double x, double y, double lockAngle);
+
+/**
+ *  Clamp a new position of the center view during a pan.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The unclamped position, in points.
+ *  @param direction The displayed side before the pan step: 1 for the left panel, -1 for the right one, else 0.
+ *  @param clamp     Filled with the clamped position. Must not be `NULL`.
+ */
+void    MSSPPanelEngineClamp(const MSSPPanelEngine *engine, double originX, int direction, MSSPPanelClamp *clamp);
+
+/**
+ *  Decide on which side the center view settles at the end of a pan.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *
+ *  @return 1 to open the left panel, -1 to open the right one, 0 to close the panel.
+ */
+int     MSSPPanelEngineSnap(const MSSPPanelEngine *engine, double originX, int direction);
+
+/**
+ *  Return the visible part of the displayed panel.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *
+ *  @return The visible part. It is greater than 1 when the center view is dragged beyond the maximum width.
+ */
+double  MSSPPanelEngineFraction(const MSSPPanelEngine *engine, double originX, int direction);
+
+/**
+ *  Fill the input of the reveal style for a position of the center view.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *  @param input     The input to fill. Must not be `NULL`.
+ */
+void    MSSPPanelEngineRevealInput(const MSSPPanelEngine *engine, double originX, int direction, MSSPRevealInput *input);
+
+/**
+ *  Return the color of the status bar for a position of the center view.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *
+ *  @return The color.
+ */
+MSSPColorComponents MSSPPanelEngineStatusBarColor(const MSSPPanelEngine *engine, double originX, int direction);
+
+/**
+ *  Compute everything which follows the position of the center view.
+ *
+ *  @param engine    The engine. Must not be `NULL`.
+ *  @param originX   The position of the center view, in points.
+ *  @param direction The displayed side: 1 for the left panel, -1 for the right one, else 0.
+ *  @param progress  Filled with the results. Must not be `NULL`.
+ */
+void    MSSPPanelEngineEvaluateProgress(const MSSPPanelEngine *engine, double originX, int direction, MSSPPanelProgress *progress);
+
+/**
+ *  Return the duration of an animation.
+ *
+ *  @param length   The distance covered by the animation, in points. Its sign is ignored.
+ *  @param velocity The velocity, in points per second. Must be greater than 0.
+ *
+ *  @return The duration, in seconds.
+ */
+double  MSSPPanelEngineAnimationDuration(double length, double velocity);
+
+/**
+ *  Return the position of the center view at a step of an animation.
+ *
+ *  @param curve    The timing curve.
+ *  @param fromX    The position at the beginning of the animation.
+ *  @param toX      The position at the end of the animation.
+ *  @param progress The progress of the time, between 0 and 1.
+ *
+ *  @return The position.
+ */
+double  MSSPPanelEngineAnimationOriginX(MSSPCurve curve, double fromX, double toX, double progress);
+
+/**
+ *  Blend two colors.
+ *
+ *  @param from     The color for a fraction of 0.
+ *  @param to       The color for a fraction of 1.
+ *  @param fraction The fraction. It isn't clamped.
+ *
+ *  @return The blended color.
+ */
+MSSPColorComponents MSSPColorComponentsBlend(MSSPColorComponents from, MSSPColorComponents to, double fraction);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+//  MSSPQualityGovernor.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+
+#include "MSSPQualityGovernor.h"
+
+#pragma mark - Macros
+
+#define MSSP_QUALITY_GOVERNOR_MISSED_FRAME_RATIO    1.5
+#define MSSP_QUALITY_GOVERNOR_RESTORE_RATIO         0.7
+
+#pragma mark - Private functions
+
+/**
+ *  Forget the recorded frames.
+ *
+ *  @param governor The governor.
+ */
+static void MSSPQualityGovernorClearFrames(MSSPQualityGovernor *governor)
+{
+    memset(governor->frameDurations, 0, sizeof(governor->frameDurations));
+    governor->framesCount = 0;
+    governor->missedFramesCount = 0;
+    governor->totalDuration = 0;
+}
+
+/**
+ *  Indicate if a frame is missed.
+ *
+ *  @param governor      The governor.
+ *  @param frameDuration The duration of the frame, in seconds.
+ *
+ *  @return 1 if the frame is missed, else 0.
+ */
+static int MSSPQualityGovernorIsFrameMissed(const MSSPQualityGovernor *governor, double frameDuration)
+{
+    return (frameDuration > governor->frameBudget * MSSP_QUALITY_GOVERNOR_MISSED_FRAME_RATIO);
+}
+
+/**
+ *  Change the level and forget the recorded frames.
+ *
+ *  @param governor The governor.
+ *  @param level    The new level.
+ */
+static void MSSPQualityGovernorSetLevel(MSSPQualityGovernor *governor, MSSPQualityLevel level)
+{
+    governor->level = level;
+    MSSPQualityGovernorClearFrames(governor);
+}
+
+#pragma mark - Functions
+
+void MSSPQualityGovernorInit(MSSPQualityGovernor *governor, double frameBudget)
+{
+    governor->frameBudget = frameBudget;
+    governor->level = MSSPQualityLevelFull;
+    governor->minimumLevel = MSSPQualityLevelFull;
+    MSSPQualityGovernorClearFrames(governor);
+}
+
+MSSPQualityLevel MSSPQualityGovernorRecordFrame(MSSPQualityGovernor *governor, double frameDuration)
+{
+    size_t  index;
+    size_t  windowCount;
+    
+    if (frameDuration <= 0)
+        return (governor->level);
+    
+    index = governor->framesCount % MSSP_QUALITY_GOVERNOR_WINDOW_SIZE;
+    
+    if (governor->framesCount >= MSSP_QUALITY_GOVERNOR_WINDOW_SIZE)
+    {
+        governor->totalDuration -= governor->frameDurations[index];
+        governor->missedFramesCount -= MSSPQualityGovernorIsFrameMissed(governor, governor->frameDurations[index]);
+    }
+    
+    governor->frameDurations[index] = frameDuration;
+    governor->totalDuration += frameDuration;
+    governor->missedFramesCount += MSSPQualityGovernorIsFrameMissed(governor, frameDuration);
+    governor->framesCount++;
+    
+    windowCount = (governor->framesCount < MSSP_QUALITY_GOVERNOR_WINDOW_SIZE ? governor->framesCount : MSSP_QUALITY_GOVERNOR_WINDOW_SIZE);
+    
+    if (governor->level < MSSPQualityLevelSnapshotCenter &&
+        windowCount >= MSSP_QUALITY_GOVERNOR_WINDOW_SIZE / 2 &&
+        governor->missedFramesCount * 4 >= windowCount)
+        MSSPQualityGovernorSetLevel(governor, governor->level + 1);
+    else if (governor->level > governor->minimumLevel &&
+             windowCount == MSSP_QUALITY_GOVERNOR_WINDOW_SIZE &&
+             governor->missedFramesCount == 0 &&
+             governor->totalDuration <= governor->frameBudget * MSSP_QUALITY_GOVERNOR_RESTORE_RATIO * windowCount)
+        MSSPQualityGovernorSetLevel(governor, governor->level - 1);
+    
+    return (governor->level);
+}
+
+void MSSPQualityGovernorSetFrameBudget(MSSPQualityGovernor *governor, double frameBudget)
+{
+    size_t  i;
+    size_t  windowCount;
+    
+    if (frameBudget <= 0 || frameBudget == governor->frameBudget)
+        return ;
+    
+    governor->frameBudget = frameBudget;
+    governor->missedFramesCount = 0;
+    
+    windowCount = (governor->framesCount < MSSP_QUALITY_GOVERNOR_WINDOW_SIZE ? governor->framesCount : MSSP_QUALITY_GOVERNOR_WINDOW_SIZE);
+    for (i = 0; i < windowCount; i++)
+        governor->missedFramesCount += MSSPQualityGovernorIsFrameMissed(governor, governor->frameDurations[i]);
+}
+
+double MSSPQualityGovernorFrameBudgetOfFrame(double timestamp, double targetTimestamp, double refreshInterval)
+{
+    return (targetTimestamp > timestamp ? targetTimestamp - timestamp : refreshInterval);
+}
+
+MSSPQualityLevel MSSPQualityGovernorSetMinimumLevel(MSSPQualityGovernor *governor, MSSPQualityLevel minimumLevel)
+{
+    governor->minimumLevel = minimumLevel;
+    
+    if (governor->level < minimumLevel)
+        MSSPQualityGovernorSetLevel(governor, minimumLevel);
+    
+    return (governor->level);
+}
@@ -0,0 +1,171 @@
+//  MSSPQualityGovernor.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_QUALITY_GOVERNOR_H
+#define MSSP_QUALITY_GOVERNOR_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  The number of frames the quality governor keeps to take its decisions.
+ */
+#define MSSP_QUALITY_GOVERNOR_WINDOW_SIZE   16
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate which optional effects are displayed during a slide. Each level drops the effects of the previous ones.
+ */
+typedef enum
+{
+    /**
+     *  Every effect is displayed.
+     */
+    MSSPQualityLevelFull            = 0,
+    
+    /**
+     *  The status bar color is not blended smoothly anymore.
+     */
+    MSSPQualityLevelSnapStatusBar   = 1,
+    
+    /**
+     *  The center view shadow is not displayed anymore.
+     */
+    MSSPQualityLevelNoShadow        = 2,
+    
+    /**
+     *  The center view content is replaced by a snapshot while it slides.
+     */
+    MSSPQualityLevelSnapshotCenter  = 3,
+} MSSPQualityLevel;
+
+#pragma mark - Structures
+
+/**
+ *  The state of a quality governor. It must be initialized with `MSSPQualityGovernorInit`.
+ */
+typedef struct
+{
+    /**
+     *  The expected duration of a frame, in seconds.
+     */
+    double              frameBudget;
+    
+    /**
+     *  The durations of the last frames, in seconds.
+     */
+    double              frameDurations[MSSP_QUALITY_GOVERNOR_WINDOW_SIZE];
+    
+    /**
+     *  The number of frames recorded since the last level change.
+     */
+    size_t              framesCount;
+    
+    /**
+     *  The number of missed frames among the recorded frames of the window.
+     */
+    size_t              missedFramesCount;
+    
+    /**
+     *  The sum of the durations of the recorded frames of the window.
+     */
+    double              totalDuration;
+    
+    /**
+     *  The current level.
+     */
+    MSSPQualityLevel    level;
+    
+    /**
+     *  The level under which the governor never goes, for example when the device saves power.
+     */
+    MSSPQualityLevel    minimumLevel;
+} MSSPQualityGovernor;
+
+#pragma mark - Functions
+
+/**
+ *  Initialize a quality governor at the full quality level.
+ *
+ *  @param governor    The governor. Must not be `NULL`.
+ *  @param frameBudget The expected duration of a frame, in seconds. Must be greater than 0.
+ */
+void                MSSPQualityGovernorInit(MSSPQualityGovernor *governor, double frameBudget);
+
+/**
+ *  Record the duration of a frame and update the level.
+ *
+ *  The level is degraded by one step when at least a quarter of the frames recorded since half a window are missed, i.e. last more than one and a half frame budget.
+ *  It is restored by one step when no frame of a complete window is missed and the frames take less than 70% of the budget in average.
+ *
+ *  @param governor      The governor. Must not be `NULL`.
+ *  @param frameDuration The duration of the frame, in seconds.
+ *
+ *  @return The new level.
+ */
+MSSPQualityLevel    MSSPQualityGovernorRecordFrame(MSSPQualityGovernor *governor, double frameDuration);
+
+/**
+ *  Set the expected duration of a frame, for example when the display refresh rate changes. The recorded frames are kept.
+ *
+ *  @param governor    The governor. Must not be `NULL`.
+ *  @param frameBudget The expected duration of a frame, in seconds. Must be greater than 0.
+ */
+void                MSSPQualityGovernorSetFrameBudget(MSSPQualityGovernor *governor, double frameBudget);
+
+/**
+ *  Return the budget of a frame, from the frame rate requested to the display rather than its refresh rate: a frame at 60 Hz is on time on a 120 Hz screen.
+ *
+ *  @param timestamp       The time of the frame, in seconds.
+ *  @param targetTimestamp The time of the next requested frame, in seconds. 0 if it is unknown.
+ *  @param refreshInterval The refresh interval of the screen, in seconds. It is the budget when the next frame is unknown.
+ *
+ *  @return The frame budget, in seconds.
+ */
+double              MSSPQualityGovernorFrameBudgetOfFrame(double timestamp, double targetTimestamp, double refreshInterval);
+
+/**
+ *  Set the level under which the governor never goes. The current level is raised if needed.
+ *
+ *  @param governor     The governor. Must not be `NULL`.
+ *  @param minimumLevel The minimum level.
+ *
+ *  @return The new level.
+ */
+MSSPQualityLevel    MSSPQualityGovernorSetMinimumLevel(MSSPQualityGovernor *governor, MSSPQualityLevel minimumLevel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,163 @@
+//  MSSPRevealStyle.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <stddef.h>
+
+#include "MSSPRevealStyle.h"
+
+#pragma mark - Macros
+
+#define MSSP_REVEAL_STYLE_SCALE_DOWN_CENTER_SCALE   0.8
+#define MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_SCALE    0.9
+#define MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_OPACITY  0.5
+#define MSSP_REVEAL_STYLE_ROTATE_3D_CENTER_ANGLE    0.4
+#define MSSP_REVEAL_STYLE_ROTATE_3D_CENTER_SCALE    0.9
+#define MSSP_REVEAL_STYLE_ROTATE_3D_PANEL_ANGLE     0.8
+
+#pragma mark - Private functions
+
+/**
+ *  Initialize layer parameters to the identity.
+ *
+ *  @param parameters The parameters.
+ */
+static void MSSPRevealLayerParametersInit(MSSPRevealLayerParameters *parameters)
+{
+    parameters->translationX = 0;
+    parameters->scale = 1;
+    parameters->rotationY = 0;
+    parameters->opacity = 1;
+}
+
+/**
+ *  Indicate if two sets of layer parameters are equal.
+ *
+ *  @param parameters1 The first parameters.
+ *  @param parameters2 The second parameters.
+ *
+ *  @return 1 if they are equal, else 0.
+ */
+static int MSSPRevealLayerParametersEqual(const MSSPRevealLayerParameters *parameters1, const MSSPRevealLayerParameters *parameters2)
+{
+    return (parameters1->translationX == parameters2->translationX &&
+            parameters1->scale == parameters2->scale &&
+            parameters1->rotationY == parameters2->rotationY &&
+            parameters1->opacity == parameters2->opacity);
+}
+
+/**
+ *  The reveal under style: the parameters stay the identity.
+ *
+ *  @param input      The state of the reveal.
+ *  @param parameters The parameters.
+ */
+static void MSSPRevealStyleEvaluateRevealUnder(const MSSPRevealInput *input, MSSPRevealParameters *parameters)
+{
+    (void)input;
+    (void)parameters;
+}
+
+/**
+ *  The slide over style: the center view content is moved back to the original position and the panel slides from the screen edge, in front of it.
+ *
+ *  @param input      The state of the reveal.
+ *  @param parameters The parameters.
+ */
+static void MSSPRevealStyleEvaluateSlideOver(const MSSPRevealInput *input, MSSPRevealParameters *parameters)
+{
+    parameters->center.translationX = -input->distance;
+    parameters->panel.translationX = -input->direction * (1 - input->fraction) * input->panelWidth;
+    parameters->panelInFront = 1;
+}
+
+/**
+ *  The scale down style: the center view content shrinks and the panel grows and fades in.
+ *
+ *  @param input      The state of the reveal.
+ *  @param parameters The parameters.
+ */
+static void MSSPRevealStyleEvaluateScaleDown(const MSSPRevealInput *input, MSSPRevealParameters *parameters)
+{
+    parameters->center.scale = 1 - (1 - MSSP_REVEAL_STYLE_SCALE_DOWN_CENTER_SCALE) * input->fraction;
+    parameters->panel.scale = MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_SCALE + (1 - MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_SCALE) * input->fraction;
+    parameters->panel.opacity = MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_OPACITY + (1 - MSSP_REVEAL_STYLE_SCALE_DOWN_PANEL_OPACITY) * input->fraction;
+}
+
+/**
+ *  The 3D rotation style: the center view content turns away from the panel, and the panel turns back to face the screen and fades in.
+ *
+ *  @param input      The state of the reveal.
+ *  @param parameters The parameters.
+ */
+static void MSSPRevealStyleEvaluateRotate3D(const MSSPRevealInput *input, MSSPRevealParameters *parameters)
+{
+    parameters->center.rotationY = -input->direction * MSSP_REVEAL_STYLE_ROTATE_3D_CENTER_ANGLE * input->fraction;
+    parameters->center.scale = 1 - (1 - MSSP_REVEAL_STYLE_ROTATE_3D_CENTER_SCALE) * input->fraction;
+    parameters->panel.rotationY = input->direction * MSSP_REVEAL_STYLE_ROTATE_3D_PANEL_ANGLE * (1 - input->fraction);
+    parameters->panel.opacity = input->fraction;
+}
+
+#pragma mark - Functions
+
+MSSPRevealStyleEvaluator MSSPRevealStyleGetEvaluator(MSSPRevealStyle style)
+{
+    switch (style)
+    {
+        case MSSPRevealStyleSlideOver:
+            return (MSSPRevealStyleEvaluateSlideOver);
+        case MSSPRevealStyleScaleDown:
+            return (MSSPRevealStyleEvaluateScaleDown);
+        case MSSPRevealStyleRotate3D:
+            return (MSSPRevealStyleEvaluateRotate3D);
+        default:
+            return (MSSPRevealStyleEvaluateRevealUnder);
+    }
+}
+
+void MSSPRevealParametersInit(MSSPRevealParameters *parameters)
+{
+    MSSPRevealLayerParametersInit(&parameters->center);
+    MSSPRevealLayerParametersInit(&parameters->panel);
+    parameters->statusBarOpacity = 1;
+    parameters->panelInFront = 0;
+}
+
+int MSSPRevealParametersEqual(const MSSPRevealParameters *parameters1, const MSSPRevealParameters *parameters2)
+{
+    return (MSSPRevealLayerParametersEqual(&parameters1->center, &parameters2->center) &&
+            MSSPRevealLayerParametersEqual(&parameters1->panel, &parameters2->panel) &&
+            parameters1->statusBarOpacity == parameters2->statusBarOpacity &&
+            parameters1->panelInFront == parameters2->panelInFront);
+}
+
+void MSSPRevealStyleEvaluate(MSSPRevealStyleEvaluator evaluator, const MSSPRevealInput *input, MSSPRevealParameters *parameters)
+{
+    MSSPRevealParametersInit(parameters);
+    
+    if (evaluator != NULL)
+        evaluator(input, parameters);
+}
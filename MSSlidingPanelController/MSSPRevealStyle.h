@@ -0,0 +1,201 @@
+//  MSSPRevealStyle.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_REVEAL_STYLE_H
+#define MSSP_REVEAL_STYLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  The distance between the eye and the screen used for the perspective of the rotations, in points.
+ */
+#define MSSP_REVEAL_STYLE_PERSPECTIVE_DISTANCE  1000
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate the built-in reveal styles.
+ */
+typedef enum
+{
+    /**
+     *  The center view slides and uncovers the panel, which stays still underneath.
+     */
+    MSSPRevealStyleRevealUnder  = 0,
+    
+    /**
+     *  The center view stays still and the panel slides over it.
+     */
+    MSSPRevealStyleSlideOver    = 1,
+    
+    /**
+     *  The center view slides and shrinks, and the panel grows and fades in underneath.
+     */
+    MSSPRevealStyleScaleDown    = 2,
+    
+    /**
+     *  The center view slides and turns away, and the panel turns back to face the screen and fades in underneath.
+     */
+    MSSPRevealStyleRotate3D     = 3,
+} MSSPRevealStyle;
+
+#pragma mark - Structures
+
+/**
+ *  The state of the reveal given to a reveal style.
+ */
+typedef struct
+{
+    /**
+     *  The visible part of the displayed panel, between 0 and 1.
+     */
+    double  fraction;
+    
+    /**
+     *  The horizontal position of the center view, in points. It is positive when the left panel is displayed and negative when the right one is.
+     */
+    double  distance;
+    
+    /**
+     *  The maximum width of the displayed panel, in points. It is 0 if no panel is displayed.
+     */
+    double  panelWidth;
+    
+    /**
+     *  1 if the left panel is displayed, -1 if the right one is, else 0.
+     */
+    int     direction;
+} MSSPRevealInput;
+
+/**
+ *  The visual parameters of a layer. The transformations are applied around the center of the layer, in this order: scale, rotation, translation.
+ */
+typedef struct
+{
+    /**
+     *  The horizontal translation, in points.
+     */
+    double  translationX;
+    
+    /**
+     *  The scale factor of both dimensions.
+     */
+    double  scale;
+    
+    /**
+     *  The rotation around the vertical axis, in radians. A non-zero rotation is displayed with perspective.
+     */
+    double  rotationY;
+    
+    /**
+     *  The opacity, between 0 and 1.
+     */
+    double  opacity;
+} MSSPRevealLayerParameters;
+
+/**
+ *  The visual parameters produced by a reveal style.
+ */
+typedef struct
+{
+    /**
+     *  The parameters of the center view content. They are added to the position of the center view.
+     */
+    MSSPRevealLayerParameters   center;
+    
+    /**
+     *  The parameters of the displayed panel. They should be the identity when the panel is completely visible.
+     */
+    MSSPRevealLayerParameters   panel;
+    
+    /**
+     *  The opacity of the status bar background, between 0 and 1.
+     */
+    double                      statusBarOpacity;
+    
+    /**
+     *  1 if the displayed panel is in front of the center view, else 0.
+     */
+    int                         panelInFront;
+} MSSPRevealParameters;
+
+#pragma mark - Types
+
+/**
+ *  A reveal style. It fills the parameters for a state of the reveal. It is called at each change of the reveal, so it must be fast and must not allocate memory.
+ *
+ *  @param input      The state of the reveal.
+ *  @param parameters The parameters. They are initialized to the identity before the call.
+ */
+typedef void (*MSSPRevealStyleEvaluator)(const MSSPRevealInput *input, MSSPRevealParameters *parameters);
+
+#pragma mark - Functions
+
+/**
+ *  Returns the evaluator of a built-in reveal style.
+ *
+ *  @param style The style.
+ *
+ *  @return The evaluator. It is the one of `MSSPRevealStyleRevealUnder` if the style is unknown.
+ */
+MSSPRevealStyleEvaluator    MSSPRevealStyleGetEvaluator(MSSPRevealStyle style);
+
+/**
+ *  Initialize reveal parameters to the identity: nothing is transformed, everything is opaque and the panel is behind the center view.
+ *
+ *  @param parameters The parameters. Must not be `NULL`.
+ */
+void                        MSSPRevealParametersInit(MSSPRevealParameters *parameters);
+
+/**
+ *  Indicate if two sets of reveal parameters are equal.
+ *
+ *  @param parameters1 The first parameters. Must not be `NULL`.
+ *  @param parameters2 The second parameters. Must not be `NULL`.
+ *
+ *  @return 1 if they are equal, else 0.
+ */
+int                         MSSPRevealParametersEqual(const MSSPRevealParameters *parameters1, const MSSPRevealParameters *parameters2);
+
+/**
+ *  Evaluate a reveal style.
+ *
+ *  @param evaluator  The evaluator. If it is `NULL`, the parameters stay the identity.
+ *  @param input      The state of the reveal. Must not be `NULL`.
+ *  @param parameters The parameters. Must not be `NULL`.
+ */
+void                        MSSPRevealStyleEvaluate(MSSPRevealStyleEvaluator evaluator, const MSSPRevealInput *input, MSSPRevealParameters *parameters);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
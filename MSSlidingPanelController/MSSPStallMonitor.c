@@ -0,0 +1,158 @@
+//  MSSPStallMonitor.c
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <string.h>
+
+#include "MSSPStallMonitor.h"
+
+#pragma mark - Private functions
+
+/**
+ *  Add the time elapsed since the last accounting to the innermost running phase.
+ *
+ *  @param monitor The monitor.
+ *  @param now     The current time.
+ */
+static void MSSPStallMonitorAccount(MSSPStallMonitor *monitor, double now)
+{
+    if (monitor->intervalRunning && now > monitor->phaseStart)
+        monitor->phaseDurations[MSSPStallMonitorGetCurrentPhase(monitor)] += now - monitor->phaseStart;
+    
+    monitor->phaseStart = now;
+}
+
+#pragma mark - Functions
+
+void MSSPStallMonitorInit(MSSPStallMonitor *monitor, double threshold)
+{
+    memset(monitor, 0, sizeof(*monitor));
+    monitor->threshold = threshold;
+}
+
+void MSSPStallMonitorBeginTransition(MSSPStallMonitor *monitor)
+{
+    monitor->transitionsCount++;
+    monitor->intervalHasTransition = 1;
+}
+
+void MSSPStallMonitorEndTransition(MSSPStallMonitor *monitor)
+{
+    if (monitor->transitionsCount > 0)
+        monitor->transitionsCount--;
+}
+
+void MSSPStallMonitorEnterPhase(MSSPStallMonitor *monitor, MSSPStallPhase phase, double now)
+{
+    MSSPStallMonitorAccount(monitor, now);
+    
+    if (monitor->depth < MSSP_STALL_MONITOR_MAXIMUM_DEPTH)
+        monitor->phases[monitor->depth] = phase;
+    
+    monitor->depth++;
+}
+
+void MSSPStallMonitorExitPhase(MSSPStallMonitor *monitor, double now)
+{
+    if (monitor->depth == 0)
+        return ;
+    
+    MSSPStallMonitorAccount(monitor, now);
+    monitor->depth--;
+}
+
+MSSPStallPhase MSSPStallMonitorGetCurrentPhase(const MSSPStallMonitor *monitor)
+{
+    if (monitor->depth == 0)
+        return (MSSPStallPhaseNone);
+    
+    if (monitor->depth > MSSP_STALL_MONITOR_MAXIMUM_DEPTH)
+        return (monitor->phases[MSSP_STALL_MONITOR_MAXIMUM_DEPTH - 1]);
+    
+    return (monitor->phases[monitor->depth - 1]);
+}
+
+int MSSPStallMonitorHeartbeat(MSSPStallMonitor *monitor, double now, MSSPStall *stall)
+{
+    double  duration;
+    int     i;
+    int     isStall;
+    
+    if (!monitor->intervalRunning)
+    {
+        MSSPStallMonitorResume(monitor, now);
+        return (0);
+    }
+    
+    MSSPStallMonitorAccount(monitor, now);
+    
+    duration = now - monitor->intervalStart;
+    isStall = (monitor->intervalHasTransition && duration > monitor->threshold);
+    
+    if (isStall && stall)
+    {
+        stall->start = monitor->intervalStart;
+        stall->duration = duration;
+        stall->phase = MSSPStallPhaseNone;
+        memcpy(stall->phaseDurations, monitor->phaseDurations, sizeof(stall->phaseDurations));
+        
+        for (i = 1; i < MSSP_STALL_PHASES_COUNT; i++)
+        {
+            if (stall->phaseDurations[i] > stall->phaseDurations[stall->phase])
+                stall->phase = (MSSPStallPhase)i;
+        }
+    }
+    
+    MSSPStallMonitorResume(monitor, now);
+    
+    return (isStall);
+}
+
+void MSSPStallMonitorResume(MSSPStallMonitor *monitor, double now)
+{
+    memset(monitor->phaseDurations, 0, sizeof(monitor->phaseDurations));
+    monitor->intervalRunning = 1;
+    monitor->intervalStart = now;
+    monitor->intervalHasTransition = (monitor->transitionsCount > 0);
+    monitor->phaseStart = now;
+}
+
+const char *MSSPStallPhaseGetName(MSSPStallPhase phase)
+{
+    switch (phase)
+    {
+        case MSSPStallPhaseDelegateCallback:
+            return ("delegate callback");
+        case MSSPStallPhasePanelLoad:
+            return ("panel load");
+        case MSSPStallPhaseStatusBarUpdate:
+            return ("status bar update");
+        case MSSPStallPhaseCompletionBlock:
+            return ("completion block");
+        default:
+            return ("none");
+    }
+}
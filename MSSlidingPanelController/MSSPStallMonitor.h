@@ -0,0 +1,246 @@
+//  MSSPStallMonitor.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef MSSP_STALL_MONITOR_H
+#define MSSP_STALL_MONITOR_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#pragma mark - Macros
+
+/**
+ *  The number of nested phases the stall monitor keeps. The deeper phases are attributed to the deepest kept one.
+ */
+#define MSSP_STALL_MONITOR_MAXIMUM_DEPTH    8
+
+/**
+ *  The number of values of `MSSPStallPhase`.
+ */
+#define MSSP_STALL_PHASES_COUNT             5
+
+#pragma mark - Enumerations
+
+/**
+ *  These values are used to indicate which work was running on the main thread.
+ */
+typedef enum
+{
+    /**
+     *  No instrumented phase: gesture handling, layout, rendering...
+     */
+    MSSPStallPhaseNone              = 0,
+    
+    /**
+     *  A method of the delegate.
+     */
+    MSSPStallPhaseDelegateCallback  = 1,
+    
+    /**
+     *  The load of a panel.
+     */
+    MSSPStallPhasePanelLoad         = 2,
+    
+    /**
+     *  The update of the status bar color.
+     */
+    MSSPStallPhaseStatusBarUpdate   = 3,
+    
+    /**
+     *  A completion block given by the user.
+     */
+    MSSPStallPhaseCompletionBlock   = 4,
+} MSSPStallPhase;
+
+#pragma mark - Structures
+
+/**
+ *  A stall of the main thread.
+ */
+typedef struct
+{
+    /**
+     *  The time at which the stall began, in seconds.
+     */
+    double          start;
+    
+    /**
+     *  The duration of the stall, in seconds.
+     */
+    double          duration;
+    
+    /**
+     *  The phase in which most of the stall was spent.
+     */
+    MSSPStallPhase  phase;
+    
+    /**
+     *  The time spent in each phase, in seconds, indexed by `MSSPStallPhase`.
+     */
+    double          phaseDurations[MSSP_STALL_PHASES_COUNT];
+} MSSPStall;
+
+/**
+ *  The state of a stall monitor. It must be initialized with `MSSPStallMonitorInit`.
+ *
+ *  The work of the main thread is cut in intervals by heartbeats. An interval is a stall if it lasts more than the threshold while a transition is running.
+ *  The monitor doesn't read the clock: every time is given by the caller, in seconds.
+ */
+typedef struct
+{
+    /**
+     *  The duration from which an interval is a stall, in seconds.
+     */
+    double          threshold;
+    
+    /**
+     *  Indicate if an interval is in progress.
+     */
+    int             intervalRunning;
+    
+    /**
+     *  The time at which the current interval began.
+     */
+    double          intervalStart;
+    
+    /**
+     *  Indicate if a transition has been running during the current interval.
+     */
+    int             intervalHasTransition;
+    
+    /**
+     *  The time from which the current phase hasn't been accounted yet.
+     */
+    double          phaseStart;
+    
+    /**
+     *  The time spent in each phase during the current interval.
+     */
+    double          phaseDurations[MSSP_STALL_PHASES_COUNT];
+    
+    /**
+     *  The stack of the running phases.
+     */
+    MSSPStallPhase  phases[MSSP_STALL_MONITOR_MAXIMUM_DEPTH];
+    
+    /**
+     *  The number of running phases. May be greater than `MSSP_STALL_MONITOR_MAXIMUM_DEPTH`.
+     */
+    size_t          depth;
+    
+    /**
+     *  The number of running transitions.
+     */
+    size_t          transitionsCount;
+} MSSPStallMonitor;
+
+#pragma mark - Functions
+
+/**
+ *  Initialize a stall monitor without any running phase nor transition.
+ *
+ *  @param monitor   The monitor. Must not be `NULL`.
+ *  @param threshold The duration from which an interval is a stall, in seconds.
+ */
+void            MSSPStallMonitorInit(MSSPStallMonitor *monitor, double threshold);
+
+/**
+ *  Tell that a transition begins. The transitions can overlap.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ */
+void            MSSPStallMonitorBeginTransition(MSSPStallMonitor *monitor);
+
+/**
+ *  Tell that a transition ends. The current interval can still be reported as a stall.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ */
+void            MSSPStallMonitorEndTransition(MSSPStallMonitor *monitor);
+
+/**
+ *  Tell that a phase begins. The phases can be nested.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ *  @param phase   The phase.
+ *  @param now     The current time.
+ */
+void            MSSPStallMonitorEnterPhase(MSSPStallMonitor *monitor, MSSPStallPhase phase, double now);
+
+/**
+ *  Tell that the innermost running phase ends. Does nothing if no phase is running.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ *  @param now     The current time.
+ */
+void            MSSPStallMonitorExitPhase(MSSPStallMonitor *monitor, double now);
+
+/**
+ *  Return the innermost running phase.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ *
+ *  @return The phase. Is `MSSPStallPhaseNone` if no phase is running.
+ */
+MSSPStallPhase  MSSPStallMonitorGetCurrentPhase(const MSSPStallMonitor *monitor);
+
+/**
+ *  End the current interval and begin a new one.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ *  @param now     The current time.
+ *  @param stall   Filled with the ended interval if it is a stall. May be `NULL`.
+ *
+ *  @return 1 if the ended interval is a stall, else 0.
+ */
+int             MSSPStallMonitorHeartbeat(MSSPStallMonitor *monitor, double now, MSSPStall *stall);
+
+/**
+ *  Begin a new interval without checking the current one, for example when the main thread wakes up after having waited.
+ *
+ *  @param monitor The monitor. Must not be `NULL`.
+ *  @param now     The current time.
+ */
+void            MSSPStallMonitorResume(MSSPStallMonitor *monitor, double now);
+
+/**
+ *  Return the name of a phase.
+ *
+ *  @param phase The phase.
+ *
+ *  @return The name.
+ */
+const char      *MSSPStallPhaseGetName(MSSPStallPhase phase);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,6 +27,12 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MSSPCurves.h"
+#import "MSSPFrameRateMeter.h"
+#import "MSSPQualityGovernor.h"
+#import "MSSPRevealStyle.h"
+#import "MSSPStallMonitor.h"
+
 #pragma mark - Enumerations & options
 
 /**
@@ -138,6 +144,32 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
     MSSPSideDisplayedRight,
 };
 
+/**
+ *  These values are used to tell how a queued open or close request ended.
+ */
+typedef NS_ENUM(NSUInteger, MSSPTransitionResult)
+{
+    /**
+     *  The requested side has been reached.
+     */
+    MSSPTransitionResultCompleted,
+    
+    /**
+     *  The requested side was already displayed: nothing has been animated.
+     */
+    MSSPTransitionResultUnchanged,
+    
+    /**
+     *  A later request has changed the side before this one was reached, so it has been dropped.
+     */
+    MSSPTransitionResultSuperseded,
+    
+    /**
+     *  The requested side hasn't been reached: the animation has been interrupted, or there is no panel on this side.
+     */
+    MSSPTransitionResultCancelled,
+};
+
 #pragma mark - Protocol declaration
 
 @protocol MSSlidingPanelControllerDelegate;
@@ -152,6 +184,10 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
  *
  *  MSSlidingPanelController shouldn't be installed as a child of another view controller. Even if you have the possibility to do it, you can encounter conflicts between containers.
  *
+ *  The open and close actions are queued: an action requested while a panel is animated waits for the end of the animation.
+ *  If several actions are waiting, only the last one is performed. The completion blocks of the actions are then executed in the order of the requests, but only for the actions whose side has been reached.
+ *  Use `setSideDisplayed:animated:completion:` to be told the result of every request, including the dropped ones.
+ *
  */
 @interface MSSlidingPanelController : UIViewController
 
@@ -208,6 +244,43 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
  */
 @property (nonatomic, strong)           UIViewController                        *centerViewController;
 
+/**
+ *  The color of the overlay which dims the center view while a panel is displayed.
+ *
+ *  By default, this value is blackColor.
+ */
+@property (nonatomic, strong)           UIColor                                 *centerViewDimmingColor;
+
+/**
+ *  The opacity of the dimming overlay when a panel is entirely displayed. The opacity is proportional to the visible part of the panel.
+ *  Set it to 0 to disable the dimming.
+ *
+ *  By default, this value is 0.
+ */
+@property (nonatomic, assign)           CGFloat                                 centerViewDimmingOpacity;
+
+/**
+ *  The color of the center view shadow.
+ *
+ *  By default, this value is blackColor.
+ */
+@property (nonatomic, strong)           UIColor                                 *centerViewShadowColor;
+
+/**
+ *  The opacity of the center view shadow when a panel is entirely displayed. The opacity is proportional to the visible part of the panel.
+ *  Set it to 0 to disable the shadow.
+ *
+ *  By default, this value is 0.
+ */
+@property (nonatomic, assign)           CGFloat                                 centerViewShadowOpacity;
+
+/**
+ *  The blur radius of the center view shadow.
+ *
+ *  By default, this value is 5.
+ */
+@property (nonatomic, assign)           CGFloat                                 centerViewShadowRadius;
+
 #pragma mark Left panel settings
 /** @name Left panel settings */
 
@@ -339,9 +412,159 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
 @property (nonatomic, assign)           CGFloat                                 animationVelocity;
 
 /**
- *  The sliding panel controller delegate.
+ *  The timing curve of the animations which open and close the panels.
+ *
+ *  By default, this value is `MSSPCurveEaseInOut`.
+ */
+@property (nonatomic, assign)           MSSPCurve                               animationCurve;
+
+/**
+ *  The built-in reveal style, which defines how the center view and the panels move while a panel is brought out.
+ *  Setting it replaces `revealStyleEvaluator` by the evaluator of the style.
+ *
+ *  By default, this value is `MSSPRevealStyleRevealUnder`.
+ */
+@property (nonatomic, assign)           MSSPRevealStyle                         revealStyle;
+
+/**
+ *  The function which evaluates the reveal style. Set it to use a custom style.
+ *  It is called with the state of the reveal each time the center view moves, and at each keyframe of the animations. It fills the transformations and the opacities of the center view content, the displayed panel and the status bar background, which are applied in one Core Animation transaction.
+ *  The touches are handled where the center view content is drawn: they are mapped through the inverse of its transformation, projected on the screen plane, before the hit-testing and the gesture modes. The center view shadow follows the outline of the transformed content, during the pannings and the animations.
+ *
+ *  By default, this value is the evaluator of `MSSPRevealStyleRevealUnder`.
+ */
+@property (nonatomic, assign)           MSSPRevealStyleEvaluator                revealStyleEvaluator;
+
+/**
+ *  Indicate if the panels' views stay in the view hierarchy once loaded.
+ *  When it is set to `YES`, the views of both panels are added once and a closed panel is only hidden. No view is added or removed when the center view crosses its original position during a panning.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    keepsPanelsLoaded;
+
+/**
+ *  The distance beyond its original position the center view must be dragged before the displayed panel is replaced by the opposite one.
+ *  The center view stays at its original position until this distance is reached, so a finger wobbling around the original position doesn't switch the panels.
+ *
+ *  By default, this value is 0.
+ */
+@property (nonatomic, assign)           CGFloat                                 panelSwitchHysteresis;
+
+/**
+ *  Indicate if the center view can be dragged beyond the maximum width of the displayed panel.
+ *  When it is set to `YES`, the center view follows the panning beyond this width with a rubber band resistance, and the panel is stretched to fill the space. It goes back to the maximum width when the panning ends.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    panRubberBandEnabled;
+
+/**
+ *  Indicate if a panning must be clearly horizontal before moving the center view.
+ *  When it is set to `YES`, a panning whose direction is too far from the horizontal fails immediately, so the scroll views of the center view can handle it. The other pannings move the center view only once their horizontal translation reaches `panDirectionLockDistance`: until then, their slide doesn't begin, so nothing is measured nor reported.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    panDirectionLockEnabled;
+
+/**
+ *  The maximum angle, in degrees, between the panning direction and the horizontal when the direction lock is enabled.
+ *
+ *  By default, this value is 30.
+ */
+@property (nonatomic, assign)           CGFloat                                 panDirectionLockAngle;
+
+/**
+ *  The horizontal translation a panning must reach before moving the center view when the direction lock is enabled.
+ *
+ *  By default, this value is 10.
+ */
+@property (nonatomic, assign)           CGFloat                                 panDirectionLockDistance;
+
+/**
+ *  Indicate if the horizontal scroll views of the center view and the displayed panel hand the panning off to the sliding panel controller when they reach their content edge.
+ *  When it is set to `YES`, a panning which begins on such a scroll view scrolls its content first. As soon as the content reaches its edge in the panning direction, the scroll view stops and the same panning opens or closes the panel, from the point where the content stopped. The two never move together, and the panel keeps the panning until it ends.
+ *  A panning which begins on a scroll view of the displayed panel can close it this way, if the close gesture mode of the panel allows to pan the content.
+ *  This replaces the usage of `slidingPanelController:gestureRecognizer:shouldRecognizeSimultaneouslyWithGestureRecognizer:` for these scroll views.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    scrollViewHandoffEnabled;
+
+/**
+ *  The width of the screen edges in which a touch tells the delegate that the corresponding panel will probably be brought out.
+ *  Set it to 0 to only use the pan velocity.
+ *
+ *  By default, this value is 20.
+ */
+@property (nonatomic, assign)           CGFloat                                 revealHintEdgeWidth;
+
+/**
+ *  Indicate if the optional effects are dropped when the slides miss frames.
+ *  When it is set to `YES`, the frame durations are watched during the slides. When too many frames are missed, the effects are dropped step by step: the smooth status bar color, then the center view shadow, then the live center view content, which is replaced by a snapshot while it slides. They come back when the slides run smoothly again.
+ *  In Low Power Mode, the smooth status bar color and the shadow are always dropped.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    adaptiveQualityEnabled;
+
+/**
+ *  The current quality level of the slides.
+ *
+ *  It is always `MSSPQualityLevelFull` when `adaptiveQualityEnabled` is `NO`.
+ */
+@property (nonatomic, assign, readonly) MSSPQualityLevel                        qualityLevel;
+
+/**
+ *  Indicate if the stalls of the main thread are watched during the slides.
+ *  When it is set to `YES`, the work of the main run loop is timed while a pan or an open/close animation is running. Each stall longer than `stallThreshold` is reported to `stallSink`, with the time spent in the delegate callbacks, the panel loads, the status bar updates and the completion blocks.
+ *
+ *  By default, this value is `NO`.
+ */
+@property (nonatomic, assign)           BOOL                                    stallWatchdogEnabled;
+
+/**
+ *  The block which receives the stalls. It is executed on the main thread, once the stall is over.
+ */
+@property (nonatomic, copy)             void                                    (^stallSink)(MSSPStall stall);
+
+/**
+ *  The duration from which the work of the main run loop is a stall.
+ *
+ *  By default, this value is 0.1 second.
+ */
+@property (nonatomic, assign)           NSTimeInterval                          stallThreshold;
+
+/**
+ *  Return the range of frame rates requested to the display while a type of transition runs.
+ *
+ *  By default, the drags and the settles which end them request up to 120 frames per second, the programmatic openings and closings request 60 frames per second to save power. The ranges are limited to the maximum frame rate of the screen.
+ *  On iPhone, the `CADisableMinimumFrameDurationOnPhone` key must be set to `YES` in the Info.plist of the application to go over 60 frames per second.
+ *
+ *  @param transitionType The type of transition.
+ *
+ *  @return The range of frame rates.
+ */
+- (MSSPFrameRateRange)frameRateRangeForTransitionType:(MSSPTransitionType)transitionType;
+
+/**
+ *  Set the range of frame rates requested to the display while a type of transition runs.
+ *
+ *  @param frameRateRange The range of frame rates.
+ *  @param transitionType The type of transition.
  */
-@property (nonatomic, strong)           id <MSSlidingPanelControllerDelegate>   delegate;
+- (void)setFrameRateRange:(MSSPFrameRateRange)frameRateRange forTransitionType:(MSSPTransitionType)transitionType;
+
+/**
+ *  The block which receives the frame rate achieved by each transition. It is executed on the main thread, once the transition is over or when a drag is followed by its settle.
+ *  Only the frames in which the center view has moved are counted.
+ */
+@property (nonatomic, copy)             void                                    (^frameRateSink)(MSSPFrameRateReport report);
+
+/**
+ *  The sliding panel controller delegate. It is not retained.
+ */
+@property (nonatomic, weak)             id <MSSlidingPanelControllerDelegate>   delegate;
 
 #pragma mark Get information about panels
 /** @name Get information about panels */
@@ -351,6 +574,31 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
  */
 @property (nonatomic, assign, readonly) MSSPSideDisplayed                       sideDisplayed;
 
+/**
+ *  Return if a panel is hidden: it has received `viewDidDisappear:` or has never appeared. A hidden panel should pause its timers, queries and animations.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return YES if the panel is hidden or if there is no panel on this side, else NO.
+ */
+- (BOOL)isPanelHiddenForSide:(MSSPSideDisplayed)side;
+
+#pragma mark Batch updates
+/** @name Batch updates */
+
+/**
+ *  Apply several settings changes at once.
+ *
+ *  Inside the `updates` block, the changes of panels' widths and panel controllers are collected instead of being applied one by one.
+ *  When the block returns, they are applied in a single layout pass, with at most one animation which goes through the transition queue. The panel controllers are installed at this moment.
+ *  The status bar colors, gesture modes and interaction modes can be changed in the block too: they are plain settings, and the status bar is refreshed once, when the changes are applied.
+ *  Calls can be nested. Only the outermost call applies the changes, and every completion block is executed once they have been applied.
+ *
+ *  @param updates    A block object which contains the settings changes.
+ *  @param completion A block object to be executed when every change has been applied.
+ */
+- (void)performBatchUpdates:(void (^)(void))updates completion:(void (^)(void))completion;
+
 #pragma mark Actions
 /** @name Actions */
 
@@ -390,6 +638,83 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
  */
 - (void)openRightPanelWithCompletion:(void (^)(void))completion;
 
+/**
+ *  Display a side.
+ *
+ *  When `animated` is `NO`, the center view and the panel are directly laid out in their final position. If the view isn't loaded yet, this is done while it is loaded, so a panel restored at launch is displayed without any animation. The delegate is told that the panel begins to be brought out and has been opened, once each.
+ *  Like the other actions, the request is queued after the running transition.
+ *
+ *  @param sideDisplayed The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated      `YES` to animate the change, else `NO`.
+ */
+- (void)setSideDisplayed:(MSSPSideDisplayed)sideDisplayed animated:(BOOL)animated;
+
+/**
+ *  Display a side, and tell how the request ended.
+ *
+ *  Unlike the completion blocks of the other actions, `completion` is always executed once, even if the request is superseded by a later one or if its animation is interrupted.
+ *  If the view isn't loaded yet and `animated` is `NO`, the side is displayed while the view is loaded and `completion` is executed immediately with `MSSPTransitionResultCompleted`.
+ *
+ *  @param sideDisplayed The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated      `YES` to animate the change, else `NO`.
+ *  @param completion    A block object to be executed when the request is done. May be `nil`.
+ */
+- (void)setSideDisplayed:(MSSPSideDisplayed)sideDisplayed animated:(BOOL)animated completion:(void (^)(MSSPTransitionResult result))completion;
+
+#pragma mark Interactive reveal
+/** @name Interactive reveal */
+
+/**
+ *  Begin to reveal a panel from an external driver: a scroll view, a custom gesture recognizer, a keyboard shortcut...
+ *
+ *  The center view is then moved by `updateRevealFraction:` exactly like by the built-in pan: it is clamped, the rubber band and the status bar color are applied and the delegate is told when the panel begins to be brought out.
+ *  The built-in pan and the tap which closes the panel can't begin until the reveal ends. Does nothing if a pan, another interactive reveal or an animated transition is running.
+ *  Each reveal must be ended by `finishInteractiveRevealWithVelocity:` or `cancelInteractiveReveal`: until then the slide stays measured and the built-in gestures stay disabled.
+ *
+ *  @param side The side to reveal. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)beginInteractiveReveal:(MSSPSideDisplayed)side;
+
+/**
+ *  Move the center view during an interactive reveal.
+ *
+ *  This method only writes the new position and its effects: it can be called at each frame.
+ *
+ *  @param fraction The visible part of the panel: 0 when it is closed, 1 when it is opened. It can be greater than 1 when the rubber band is enabled.
+ */
+- (void)updateRevealFraction:(CGFloat)fraction;
+
+/**
+ *  End an interactive reveal: the panel is opened or closed with an animation.
+ *
+ *  A fast enough velocity decides the result. Otherwise the panel is opened if more than its half is visible.
+ *
+ *  @param velocity The velocity of the reveal, in panel widths per second. It is positive when the panel is opening.
+ */
+- (void)finishInteractiveRevealWithVelocity:(CGFloat)velocity;
+
+/**
+ *  Cancel an interactive reveal: the side displayed when it began is displayed again with an animation.
+ */
+- (void)cancelInteractiveReveal;
+
+#pragma mark State restoration
+/** @name State restoration */
+
+/**
+ *  Encode the displayed side and the panels' widths. Like every view controller, the sliding panel controller must have a restoration identifier to be saved.
+ *
+ *  @param coder The coder object to use to encode the state.
+ */
+- (void)encodeRestorableStateWithCoder:(NSCoder *)coder;
+
+/**
+ *  Decode and restore the displayed side and the panels' widths. The side is displayed without animation.
+ *
+ *  @param coder The coder object to use to decode the state.
+ */
+- (void)decodeRestorableStateWithCoder:(NSCoder *)coder;
+
 @end
 
 #pragma mark - Protocol
@@ -406,6 +731,18 @@ typedef NS_ENUM(NSUInteger, MSSPSideDisplayed)
  */
 - (void)slidingPanelController:(MSSlidingPanelController *)panelController beginsToBringOutSide:(MSSPSideDisplayed)side;
 
+/**
+ *  Tells the delegate that the specified side will probably be brought out soon.
+ *
+ *  This method is called before `slidingPanelController:beginsToBringOutSide:`, as soon as a touch begins in an edge of the center view or the panning direction and velocity are known.
+ *  It is the good place to start loading the data displayed by the panel. It is called at most once per side and per gesture, and the side may finally not be brought out.
+ *
+ *  @param panelController The panel controller.
+ *  @param side            The side.
+ *  @param timeInterval    The estimated time before the panel is entirely visible.
+ */
+- (void)slidingPanelController:(MSSlidingPanelController *)panelController willProbablyBringOutSide:(MSSPSideDisplayed)side inTimeInterval:(NSTimeInterval)timeInterval;
+
 /**
  *  Tells the delegate that the specified side has been closed.
  *
@@ -25,7 +25,11 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#import <QuartzCore/QuartzCore.h>
+
 #import "MSSlidingPanelController.h"
+#import "MSSPPanelEngine.h"
+#import "MSSPPanTracker.h"
 
 #pragma mark - Macros
 
@@ -33,10 +37,127 @@
 #define MSSPStoryboardIDLeft    @"MSSPStoryboardIDLeft"
 #define MSSPStoryboardIDRight   @"MSSPStoryboardIDRight"
 
+#define MSSPRestorationKeyLeftPanelMaximumWidth     @"MSSPRestorationKeyLeftPanelMaximumWidth"
+#define MSSPRestorationKeyRightPanelMaximumWidth    @"MSSPRestorationKeyRightPanelMaximumWidth"
+#define MSSPRestorationKeySideDisplayed             @"MSSPRestorationKeySideDisplayed"
+
+#define MSSPSideMask(side)  ((NSUInteger)1 << (side))
+
+#define MSSPAnimationKeyCompletion  @"MSSPAnimationKeyCompletion"
+
 #pragma mark - Global variables
 
+NSUInteger  g_animationKeyframesCount = 16;
 CGFloat     g_animationVelocity = 640;
+CGFloat     g_centerViewShadowRadius = 5;
+CGFloat     g_interactiveRevealFlingVelocity = 0.5;
 NSUInteger  g_panelMaximumWidth = 280;
+CGFloat     g_panDirectionLockAngle = 30;
+CGFloat     g_panDirectionLockDistance = 10;
+CGFloat     g_revealHintEdgeWidth = 20;
+CGFloat     g_revealHintMinimumVelocity = 200;
+CGFloat     g_stallThreshold = 0.1;
+
+#pragma mark - Functions
+
+/**
+ *  Returns the components of a color.
+ *
+ *  @param color The color.
+ *
+ *  @return The components.
+ */
+static MSSPColorComponents MSSPColorComponentsWithColor(UIColor *color)
+{
+    CGFloat alpha;
+    CGFloat blue;
+    CGFloat green;
+    CGFloat red;
+    
+    if (![color getRed:&red green:&green blue:&blue alpha:&alpha])
+    {
+        [color getWhite:&red alpha:&alpha];
+        
+        green = red;
+        blue = red;
+    }
+    
+    return ((MSSPColorComponents){red, green, blue, alpha});
+}
+
+/**
+ *  Returns the position of a point transformed by a 3D transformation, projected on the plane of the screen.
+ *
+ *  @param point     The point, relative to the anchor of the transformation.
+ *  @param transform The transformation.
+ *
+ *  @return The transformed point, relative to the anchor of the transformation.
+ */
+static CGPoint MSSPPointByApplyingTransform(CGPoint point, CATransform3D transform)
+{
+    CGFloat w;
+    
+    w = point.x * transform.m14 + point.y * transform.m24 + transform.m44;
+    
+    if (w == 0)
+        return (CGPointMake(CGFLOAT_MAX, CGFLOAT_MAX));
+    
+    return (CGPointMake((point.x * transform.m11 + point.y * transform.m21 + transform.m41) / w,
+                        (point.x * transform.m12 + point.y * transform.m22 + transform.m42) / w));
+}
+
+/**
+ *  Returns the point which a 3D transformation, projected on the plane of the screen, moves to a given point. This is the inverse of `MSSPPointByApplyingTransform`.
+ *
+ *  @param point     The transformed point, relative to the anchor of the transformation.
+ *  @param transform The transformation.
+ *
+ *  @return The original point, relative to the anchor of the transformation.
+ */
+static CGPoint MSSPPointByInvertingTransform(CGPoint point, CATransform3D transform)
+{
+    CGFloat u;
+    CGFloat v;
+    CGFloat w;
+    
+    u = point.x * (transform.m22 * transform.m44 - transform.m24 * transform.m42) +
+        point.y * (transform.m24 * transform.m41 - transform.m21 * transform.m44) +
+        (transform.m21 * transform.m42 - transform.m22 * transform.m41);
+    v = point.x * (transform.m14 * transform.m42 - transform.m12 * transform.m44) +
+        point.y * (transform.m11 * transform.m44 - transform.m14 * transform.m41) +
+        (transform.m12 * transform.m41 - transform.m11 * transform.m42);
+    w = point.x * (transform.m12 * transform.m24 - transform.m14 * transform.m22) +
+        point.y * (transform.m14 * transform.m21 - transform.m11 * transform.m24) +
+        (transform.m11 * transform.m22 - transform.m12 * transform.m21);
+    
+    if (w == 0)
+        return (CGPointMake(CGFLOAT_MAX, CGFLOAT_MAX));
+    
+    return (CGPointMake(u / w, v / w));
+}
+
+/**
+ *  Returns the transformation corresponding to reveal layer parameters.
+ *
+ *  @param parameters The parameters.
+ *
+ *  @return The transformation.
+ */
+static CATransform3D MSSPTransformWithRevealLayerParameters(const MSSPRevealLayerParameters *parameters)
+{
+    CATransform3D   transform;
+    
+    transform = CATransform3DIdentity;
+    
+    if (parameters->rotationY != 0)
+        transform.m34 = -1.0 / MSSP_REVEAL_STYLE_PERSPECTIVE_DISTANCE;
+    
+    transform = CATransform3DTranslate(transform, parameters->translationX, 0, 0);
+    transform = CATransform3DRotate(transform, parameters->rotationY, 0, 1, 0);
+    transform = CATransform3DScale(transform, parameters->scale, parameters->scale, 1);
+    
+    return (transform);
+}
 
 #pragma mark - Enumeration
 
@@ -56,6 +177,32 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
     MSSPPanTouchLocationNavBar = MSSPOpenGestureModePanNavBar,
 };
 
+/**
+ *  These values are used to know where a panel is in its appearance transitions.
+ */
+typedef NS_ENUM(NSUInteger, MSSPAppearanceState)
+{
+    /**
+     *  The panel has disappeared or has never appeared.
+     */
+    MSSPAppearanceStateDisappeared = 0,
+    
+    /**
+     *  The panel has received `viewWillAppear:`.
+     */
+    MSSPAppearanceStateAppearing,
+    
+    /**
+     *  The panel has received `viewDidAppear:`.
+     */
+    MSSPAppearanceStateAppeared,
+    
+    /**
+     *  The panel has received `viewWillDisappear:`.
+     */
+    MSSPAppearanceStateDisappearing,
+};
+
 #pragma mark - Interfaces
 
 /**
@@ -73,9 +220,45 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  */
 @property (nonatomic, weak) MSSlidingPanelController    *slidingPanelController;
 
+#pragma mark Depth effects
+/** @name Depth effects */
+
+/**
+ *  The layer which dims the content of the center view.
+ */
+@property (nonatomic, strong) CALayer                   *dimmingLayer;
+
+/**
+ *  The size for which the dimming layer frame has been computed.
+ */
+@property (nonatomic, assign) CGSize                    effectsSize;
+
+/**
+ *  Return the shadow path which follows the content of the view when its sublayers are transformed.
+ *
+ *  @param transform The transformation of the sublayers.
+ *
+ *  @return The shadow path: the outline of the transformed bounds.
+ */
+- (UIBezierPath *)shadowPathWithSublayerTransform:(CATransform3D)transform;
+
+/**
+ *  Set the shadow path for the current transformation of the sublayers.
+ */
+- (void)updateShadowPath;
+
 #pragma mark Manage center view's touches
 /** @name Manage center view's touches */
 
+/**
+ *  Return the point of the content displayed at a point of the view, when the sublayers are transformed by the reveal style.
+ *
+ *  @param point The point, in the coordinate system of the view.
+ *
+ *  @return The point of the untransformed content, in the coordinate system of the view.
+ */
+- (CGPoint)contentPointWithPoint:(CGPoint)point;
+
 /**
  *  Return the navigation bar object in view the view is included.
  *
@@ -87,7 +270,63 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
 
 @end
 
-@interface MSSlidingPanelController () <UIGestureRecognizerDelegate>
+/**
+ *  The target of the frame monitor. A display link retains its target: this one forwards the frames to the sliding panel controller without retaining it.
+ */
+@interface MSSlidingPanelFrameMonitorTarget : NSObject
+
+#pragma mark Access to the sliding panel controller
+/** @name Access to the sliding panel controller */
+
+/**
+ *  The sliding panel controller which receives the frames.
+ */
+@property (nonatomic, weak) MSSlidingPanelController    *slidingPanelController;
+
+#pragma mark Frames
+/** @name Frames */
+
+/**
+ *  Called at each frame by the frame monitor.
+ *
+ *  @param displayLink The display link.
+ */
+- (void)frameMonitorFired:(CADisplayLink *)displayLink;
+
+@end
+
+@interface MSSlidingPanelController () <CAAnimationDelegate, UIGestureRecognizerDelegate>
+{
+    /**
+     *  The meter of the frame rate achieved by the transitions.
+     */
+    MSSPFrameRateMeter      _frameRateMeter;
+    
+    /**
+     *  The ranges of frame rates requested for each type of transition.
+     */
+    MSSPFrameRateRange      _frameRateRanges[MSSP_TRANSITION_TYPES_COUNT];
+    
+    /**
+     *  The tracker of the pan gesture.
+     */
+    MSSPPanTracker          _panTracker;
+    
+    /**
+     *  The quality governor of the slides.
+     */
+    MSSPQualityGovernor     _qualityGovernor;
+    
+    /**
+     *  The reveal parameters applied to the layers.
+     */
+    MSSPRevealParameters    _revealParameters;
+    
+    /**
+     *  The stall monitor of the main thread.
+     */
+    MSSPStallMonitor        _stallMonitor;
+}
 
 #pragma mark Status bar
 /** @name Status bar */
@@ -109,6 +348,73 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
 
 @property (nonatomic, strong)   MSSlidingPanelCenterView    *centerView;
 
+/**
+ *  Add to a layer an animation between two opacity values, following the animation curve.
+ *
+ *  @param layer     The layer.
+ *  @param keyPath   The key path of the opacity.
+ *  @param fromValue The opacity at the beginning of the animation.
+ *  @param toValue   The opacity at the end of the animation.
+ *  @param duration  The duration of the animation.
+ */
+- (void)addOpacityAnimationToLayer:(CALayer *)layer forKeyPath:(NSString *)keyPath fromValue:(float)fromValue toValue:(float)toValue withDuration:(NSTimeInterval)duration;
+
+/**
+ *  Apply the shadow and dimming settings to the center view.
+ */
+- (void)applyCenterViewEffectsSettings;
+
+/**
+ *  Set the shadow and dimming opacities of the center view for a visible part of the displayed panel.
+ *
+ *  @param fraction The visible part of the displayed panel, between 0 and 1.
+ *  @param duration The duration of the change. 0 changes the opacities immediately.
+ */
+- (void)setCenterViewEffectsFraction:(CGFloat)fraction withDuration:(NSTimeInterval)duration;
+
+#pragma mark Reveal style
+/** @name Reveal style */
+
+/**
+ *  Add to the center view, the displayed panel and the status bar the animations of the reveal style toward a position of the center view. The final values are applied immediately.
+ *
+ *  @param originX  The horizontal position of the center view at the end of the animation.
+ *  @param duration The duration of the animation.
+ */
+- (void)addRevealStyleAnimationsToOriginX:(CGFloat)originX withDuration:(NSTimeInterval)duration;
+
+/**
+ *  Apply reveal parameters to the center view, the displayed panel and the status bar, in one transaction. Nothing is done if they are already applied.
+ *
+ *  @param parameters The parameters.
+ */
+- (void)applyRevealParameters:(const MSSPRevealParameters *)parameters;
+
+/**
+ *  Apply the reveal style for the current position of the center view.
+ */
+- (void)applyRevealStyle;
+
+/**
+ *  Evaluate the reveal style for a position of the center view.
+ *
+ *  @param originX    The horizontal position of the center view.
+ *  @param parameters The parameters to fill.
+ */
+- (void)evaluateRevealStyleForCenterViewOriginX:(CGFloat)originX parameters:(MSSPRevealParameters *)parameters;
+
+/**
+ *  Remove the reveal style of a panel view, when it isn't displayed anymore.
+ *
+ *  @param panelView The view of the panel.
+ */
+- (void)resetRevealStyleOfPanelView:(UIView *)panelView;
+
+/**
+ *  Indicate if `_revealParameters` are applied to the layers.
+ */
+@property (nonatomic, assign)   BOOL                        revealParametersApplied;
+
 #pragma mark Panels settings
 /** @name Panels settings */
 
@@ -121,6 +427,13 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  */
 - (void)setPanelMaximumWidth:(CGFloat)panelMaximumWidth forSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion;
 
+/**
+ *  Stretch the displayed panel so it fills the space uncovered by the center view when this one is dragged beyond the maximum width of the panel.
+ *
+ *  @param originX The horizontal position of the center view.
+ */
+- (void)stretchDisplayedPanelToCenterViewOriginX:(CGFloat)originX;
+
 #pragma mark Panels information
 /** @name Panels information */
 
@@ -168,6 +481,16 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
 #pragma mark Tools
 /** @name Tools */
 
+/**
+ *  Add to a layer a keyframe animation of a property. Nothing is added if all the values are equal.
+ *
+ *  @param layer    The layer.
+ *  @param keyPath  The key path of the property.
+ *  @param values   The values of the keyframes, evenly spread over the duration.
+ *  @param duration The duration of the animation.
+ */
+- (void)addKeyframeAnimationToLayer:(CALayer *)layer forKeyPath:(NSString *)keyPath withValues:(NSArray *)values duration:(NSTimeInterval)duration;
+
 /**
  *  Adjust the status bar color.
  */
@@ -226,6 +549,15 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  */
 - (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldReceiveTouch:(UITouch *)touch;
 
+/**
+ *  Asks the delegate if a gesture recognizer should begin interpreting touches.
+ *
+ *  @param gestureRecognizer The gesture recognizer.
+ *
+ *  @return YES (the default) to tell the gesture recognizer to proceed with interpreting touches, NO to prevent it from attempting to recognize its gesture.
+ */
+- (BOOL)gestureRecognizerShouldBegin:(UIGestureRecognizer *)gestureRecognizer;
+
 /**
  *  Return the list of the possible closing gestures recognized.
  *
@@ -284,21 +616,155 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  */
 - (void)panGestureVerifyAuthorizationForNewCenterViewFrame:(CGRect *)newCenterViewFrame;
 
+/**
+ *  Indicate if the current panning has reached the direction lock distance.
+ */
+@property (nonatomic, assign)   BOOL                        panDirectionLocked;
+
+/**
+ *  Indicate if the current panning moves the center view: its slide begins only when the direction lock is reached.
+ */
+@property (nonatomic, assign)   BOOL                        panSliding;
+
 /**
  *  The original panning touch location : navigation bar or content.
  */
 @property (nonatomic, assign)   MSSPPanTouchLocation        panTouchLocation;
 
 /**
- *  The pan gesture translation translation.
+ *  The touch which owns the current panning.
+ */
+@property (nonatomic, weak)     UITouch                     *panOwnerTouch;
+
+/**
+ *  The horizontal translation absorbed by the panel switch hysteresis since the center view has been stopped at its original position.
+ */
+@property (nonatomic, assign)   CGFloat                     panHysteresisTranslation;
+
+/**
+ *  The horizontal translation absorbed by the rubber band since the center view has been dragged beyond the maximum width of the displayed panel.
  */
-@property (nonatomic, assign)   CGPoint                     panTranslation;
+@property (nonatomic, assign)   CGFloat                     panOverscrollTranslation;
 
 /**
  *  Set the gesture recognizers.
  */
 - (void)setGestureRecognizers;
 
+/**
+ *  Move the center view during an interactive slide: the frame is clamped, the panels are loaded and the delegate is told, then the status bar and the effects follow the new position.
+ *
+ *  @param newCenterViewFrame The new center view frame.
+ */
+- (void)slideCenterViewToFrame:(CGRect)newCenterViewFrame;
+
+/**
+ *  End the current panning and move the center view to a stable position.
+ *
+ *  @param ending The way the panning ends.
+ */
+- (void)settlePanWithEnding:(MSSPPanEnding)ending;
+
+/**
+ *  Begin the slide of the current panning, which then moves the center view.
+ */
+- (void)beginPanSlide;
+
+/**
+ *  Forget the current panning before it moves the center view. Nothing has been begun, so nothing is torn down.
+ */
+- (void)abandonPan;
+
+#pragma mark Scroll view handoff
+/** @name Scroll view handoff */
+
+/**
+ *  Indicate if a scroll view can still scroll in the direction of a panning translation.
+ *
+ *  @param scrollView   The scroll view.
+ *  @param translationX The horizontal panning translation.
+ *
+ *  @return YES if the scroll view is not at its content edge in this direction, else NO.
+ */
+- (BOOL)canScrollView:(UIScrollView *)scrollView scrollForTranslation:(CGFloat)translationX;
+
+/**
+ *  The scroll view under the touch of the current panning, which scrolls with the panning until it reaches its content edge.
+ */
+@property (nonatomic, weak)     UIScrollView                *handoffScrollView;
+
+/**
+ *  Indicate if the current panning follows the handoff scroll view without moving the center view.
+ */
+@property (nonatomic, assign)   BOOL                        panHandoffFollowing;
+
+/**
+ *  Return the scroll view which can own a panning, under a touch.
+ *
+ *  @param touch The touch.
+ *
+ *  @return The nearest horizontal scroll view containing the touch, or `nil` if there is none or if the handoff is disabled.
+ */
+- (UIScrollView *)handoffScrollViewForTouch:(UITouch *)touch;
+
+/**
+ *  Indicate if a scroll view can own the panning instead of the center view.
+ *
+ *  @param scrollView The scroll view.
+ *
+ *  @return YES if the scroll view scrolls horizontally and belongs to the center view or a panel, else NO.
+ */
+- (BOOL)isHandoffCandidateScrollView:(UIScrollView *)scrollView;
+
+/**
+ *  Give the current panning to the center view if the handoff scroll view has reached its content edge in the panning direction.
+ *  The scroll view is then stopped at its edge, and the part of the translation which went beyond the edge moves the center view.
+ *
+ *  @param translationX The horizontal translation of the panning since its beginning.
+ *
+ *  @return YES if the center view owns the panning, else NO.
+ */
+- (BOOL)takeOverPanFromHandoffScrollViewWithTranslation:(CGFloat)translationX;
+
+#pragma mark Reveal hints
+/** @name Reveal hints */
+
+/**
+ *  Tell the delegate that a side will probably be brought out, if it has not already been told during the current gesture.
+ *
+ *  @param side         The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param timeInterval The estimated time before the panel is entirely visible.
+ */
+- (void)hintRevealOfSide:(MSSPSideDisplayed)side inTimeInterval:(NSTimeInterval)timeInterval;
+
+/**
+ *  Tell the delegate which side will probably be brought out in function of the panning velocity.
+ *
+ *  @param velocity The panning velocity.
+ */
+- (void)hintRevealWithPanVelocity:(CGPoint)velocity;
+
+/**
+ *  Tell the delegate which side will probably be brought out in function of the location of a touch which begins.
+ *
+ *  @param touch The touch.
+ */
+- (void)hintRevealWithTouch:(UITouch *)touch;
+
+/**
+ *  Indicate if a side can be brought out by the current panning.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return YES if the side can be brought out, else NO.
+ */
+- (BOOL)isRevealOfSideAllowedByPanning:(MSSPSideDisplayed)side;
+
+/**
+ *  The sides for which the delegate has already been told during the current gesture, as a combination of `MSSPSideMask()`.
+ */
+@property (nonatomic, assign)   NSUInteger                  revealHintSides;
+
 /**
  *  Called when a tap is recognized.
  *
@@ -314,6 +780,13 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
 #pragma mark Load and unload panels
 /** @name Load and unload panels */
 
+/**
+ *  Add the view of a panel to the view hierarchy, if it is not already there.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)installPanelViewForSide:(MSSPSideDisplayed)side;
+
 /**
  *  Load the left panel.
  */
@@ -354,14 +827,90 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  */
 - (void)unloadRightPanel;
 
-#pragma mark Actions
-/** @name Actions */
+#pragma mark Appearance
+/** @name Appearance */
 
 /**
- *  Open the panel corresponding to the side.
+ *  Return the appearance state of a panel.
  *
- *  @param side       The side. Must not be `MSSPSideDisplayedNone`.
- *  @param completion A block object to be executed when the panel is opened.
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return The appearance state.
+ */
+- (MSSPAppearanceState)appearanceStateOfPanelForSide:(MSSPSideDisplayed)side;
+
+/**
+ *  Tell a panel that it begins to appear or to disappear, if it is not already doing so. A panel only appears while the view of the sliding panel controller is visible.
+ *
+ *  @param side      The side.
+ *  @param appearing `YES` if the panel begins to appear, `NO` if it begins to disappear.
+ *  @param animated  `YES` if the transition is animated, else `NO`.
+ */
+- (void)beginAppearanceTransitionOfPanelForSide:(MSSPSideDisplayed)side appearing:(BOOL)appearing animated:(BOOL)animated;
+
+/**
+ *  Tell a panel that its current appearance transition ends. Does nothing if no transition is running.
+ *
+ *  @param side The side.
+ */
+- (void)endAppearanceTransitionOfPanelForSide:(MSSPSideDisplayed)side;
+
+/**
+ *  The appearance state of the left panel.
+ */
+@property (nonatomic, assign)   MSSPAppearanceState         leftPanelAppearanceState;
+
+/**
+ *  The appearance state of the right panel.
+ */
+@property (nonatomic, assign)   MSSPAppearanceState         rightPanelAppearanceState;
+
+/**
+ *  Set the appearance state of a panel.
+ *
+ *  @param appearanceState The appearance state.
+ *  @param side            The side. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)setAppearanceState:(MSSPAppearanceState)appearanceState ofPanelForSide:(MSSPSideDisplayed)side;
+
+/**
+ *  Indicate if the view of the sliding panel controller is appearing or has appeared.
+ */
+@property (nonatomic, assign)   BOOL                        viewVisible;
+
+#pragma mark Actions
+/** @name Actions */
+
+/**
+ *  Animate the center view to a horizontal position, following the animation curve.
+ *
+ *  @param originX    The horizontal position of the center view at the end of the animation.
+ *  @param duration   The duration of the animation.
+ *  @param animations A block object containing the other changes to animate. May be `nil`.
+ *  @param completion A block object to be executed when the animation ends.
+ */
+- (void)animateCenterViewToOriginX:(CGFloat)originX withDuration:(NSTimeInterval)duration animations:(void (^)(void))animations completion:(void (^)(BOOL finished))completion;
+
+/**
+ *  Tells the delegate the animation has ended. Execute the completion block of the animations of the center view.
+ *
+ *  @param animation The CAAnimation object that has ended.
+ *  @param finished  YES if the animation has completed its full duration, NO if it was removed before.
+ */
+- (void)animationDidStop:(CAAnimation *)animation finished:(BOOL)finished;
+
+/**
+ *  Animate the closing of the opened panel.
+ *
+ *  @param completion A block object to be executed when the animation ends, even if no panel was opened. Its parameter is NO if the animation has been interrupted.
+ */
+- (void)animateClosePanelWithCompletion:(void (^)(BOOL finished))completion;
+
+/**
+ *  Open the panel corresponding to the side.
+ *
+ *  @param side       The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param completion A block object to be executed when the panel is opened.
  */
 - (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion;
 
@@ -369,10 +918,306 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
  *  Open the panel corresponding to the side.
  *
  *  @param side                 The side. Must not be `MSSPSideDisplayedNone`.
- *  @param completion           A block object to be executed when the panel is opened.
+ *  @param completion           A block object to be executed when the animation ends. Its parameter is NO if the animation has been interrupted or if there is no panel on this side.
  *  @param statusBarColorUpdate A value which indicate if the status bar color must be updated before the animation.
  */
-- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion andStatusBarColorUpdate:(BOOL)statusBarColorUpdate;
+- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(BOOL finished))completion andStatusBarColorUpdate:(BOOL)statusBarColorUpdate;
+
+/**
+ *  Lay out a side directly in its final position, without animation.
+ *
+ *  @param side The side. `MSSPSideDisplayedNone` closes the opened panel.
+ */
+- (void)displaySideWithoutAnimation:(MSSPSideDisplayed)side;
+
+/**
+ *  The side to display without animation when the view is loaded.
+ */
+@property (nonatomic, assign)   MSSPSideDisplayed           sideDisplayedAtLoad;
+
+#pragma mark Interactive reveal
+/** @name Interactive reveal */
+
+/**
+ *  End the interactive reveal and animate the center view to a side.
+ *
+ *  @param side The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ */
+- (void)endInteractiveRevealOnSide:(MSSPSideDisplayed)side;
+
+/**
+ *  The side revealed by an external driver, or `MSSPSideDisplayedNone` if there is no interactive reveal.
+ */
+@property (nonatomic, assign)   MSSPSideDisplayed           interactiveRevealSide;
+
+/**
+ *  The side displayed when the interactive reveal began, reached again when it is cancelled.
+ */
+@property (nonatomic, assign)   MSSPSideDisplayed           interactiveRevealStartSide;
+
+#pragma mark Transition queue
+/** @name Transition queue */
+
+/**
+ *  Add a request to the transition queue.
+ *
+ *  The pending requests are collapsed to the last requested side. Their completion blocks are executed in order, once the side has been reached. The requests for another side receive `MSSPTransitionResultSuperseded`.
+ *
+ *  @param side       The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated   `YES` to animate the transition, else `NO`.
+ *  @param completion A block object to be executed when the request is done.
+ */
+- (void)enqueueTransitionToSide:(MSSPSideDisplayed)side animated:(BOOL)animated withCompletion:(void (^)(MSSPTransitionResult result))completion;
+
+/**
+ *  Start the pending transition if there is one, else execute the remaining completion blocks.
+ */
+- (void)runPendingTransition;
+
+/**
+ *  Return a transition completion block which executes the completion block of an action only if the action has reached its side, like before the actions were queued.
+ *
+ *  @param completion The completion block of the action. May be `nil`.
+ *  @param side       The side requested by the action.
+ *
+ *  @return The transition completion block, or `nil` if `completion` is `nil`.
+ */
+- (void (^)(MSSPTransitionResult result))transitionCompletionWithActionCompletion:(void (^)(void))completion toSide:(MSSPSideDisplayed)side;
+
+/**
+ *  The completion blocks of the requests which are not started yet, each one bound to the side of its request.
+ */
+@property (nonatomic, strong)   NSMutableArray              *transitionCompletions;
+
+/**
+ *  Indicate if a request is waiting in the queue.
+ */
+@property (nonatomic, assign)   BOOL                        transitionPending;
+
+/**
+ *  Indicate if the last request of the queue is animated.
+ */
+@property (nonatomic, assign)   BOOL                        transitionPendingAnimated;
+
+/**
+ *  The side requested by the last request of the queue.
+ */
+@property (nonatomic, assign)   MSSPSideDisplayed           transitionPendingSide;
+
+/**
+ *  Indicate if a transition is currently animated.
+ */
+@property (nonatomic, assign)   BOOL                        transitionRunning;
+
+#pragma mark Adaptive quality
+/** @name Adaptive quality */
+
+/**
+ *  Apply the effects corresponding to the quality level.
+ */
+- (void)applyQualityLevel;
+
+/**
+ *  Tell that a slide, interactive or animated, begins.
+ */
+- (void)beginSlide;
+
+/**
+ *  The snapshot which replaces the center view content while it slides.
+ */
+@property (nonatomic, strong)   UIView                      *centerViewSnapshot;
+
+/**
+ *  Tell that a slide, interactive or animated, ends.
+ */
+- (void)endSlide;
+
+/**
+ *  Report the frame rate of the measured transition and stop the frame monitor.
+ */
+- (void)stopFrameMonitor;
+
+/**
+ *  Called at each frame while a slide is running.
+ *
+ *  @param displayLink The display link.
+ */
+- (void)frameMonitorFired:(CADisplayLink *)displayLink;
+
+/**
+ *  The display link which watches the frames while a slide is running.
+ */
+@property (nonatomic, strong)   CADisplayLink               *frameMonitor;
+
+/**
+ *  The timestamp of the last frame watched.
+ */
+@property (nonatomic, assign)   CFTimeInterval              frameMonitorTimestamp;
+
+/**
+ *  The horizontal position of the presentation of the center view at the last frame which moved it.
+ */
+@property (nonatomic, assign)   CGFloat                     frameMonitorCenterViewOriginX;
+
+/**
+ *  The current quality level of the slides.
+ */
+@property (nonatomic, assign)   MSSPQualityLevel            qualityLevel;
+
+/**
+ *  The number of slides currently running.
+ */
+@property (nonatomic, assign)   NSUInteger                  slidesCount;
+
+#pragma mark Frame rate
+/** @name Frame rate */
+
+/**
+ *  Request the frame rate range of a type of transition to the frame monitor.
+ *
+ *  @param transitionType The type of transition.
+ */
+- (void)applyFrameRateRangeOfTransitionType:(MSSPTransitionType)transitionType;
+
+/**
+ *  Request the frame rate range of the running slide to an animation.
+ *
+ *  @param animation The animation.
+ */
+- (void)applyFrameRateRangeToAnimation:(CAAnimation *)animation;
+
+/**
+ *  Report the frame rate achieved by the measured transition to the frame rate sink, and begin to measure another one.
+ *
+ *  @param transitionType The type of the next transition.
+ */
+- (void)beginFrameRateMeasureOfTransitionType:(MSSPTransitionType)transitionType;
+
+/**
+ *  Report the frame rate achieved by the measured transition to the frame rate sink.
+ */
+- (void)endFrameRateMeasure;
+
+/**
+ *  Return the maximum frame rate of the screen.
+ *
+ *  @return The maximum frame rate, in frames per second.
+ */
+- (double)maximumFrameRate;
+
+/**
+ *  The type of the next slide.
+ */
+@property (nonatomic, assign)   MSSPTransitionType          nextSlideType;
+
+/**
+ *  The type of the running slide.
+ */
+@property (nonatomic, assign)   MSSPTransitionType          slideType;
+
+#pragma mark Panel engine
+/** @name Panel engine */
+
+/**
+ *  Fill the panel engine with the current panels and settings. The status bar colors are not filled.
+ *
+ *  @param engine The engine.
+ */
+- (void)fillPanelEngine:(MSSPPanelEngine *)engine;
+
+/**
+ *  Return the displayed side as expected by the panel engine.
+ *
+ *  @return 1 if the left panel is displayed, -1 if the right one is, else 0.
+ */
+- (int)panelEngineDirection;
+
+#pragma mark Stall watchdog
+/** @name Stall watchdog */
+
+/**
+ *  Tell that a phase of a transition begins on the main thread.
+ *
+ *  @param phase The phase.
+ */
+- (void)enterStallPhase:(MSSPStallPhase)phase;
+
+/**
+ *  Tell that the innermost phase of a transition ends on the main thread.
+ */
+- (void)exitStallPhase;
+
+/**
+ *  Called by the stall observer at each step of the main run loop.
+ *
+ *  @param activity The step of the run loop.
+ */
+- (void)stallObserverFiredWithActivity:(CFRunLoopActivity)activity;
+
+/**
+ *  The observer of the main run loop which times its work.
+ */
+@property (nonatomic, assign)   CFRunLoopObserverRef        stallObserver;
+
+#pragma mark Delegate notifications
+/** @name Delegate notifications */
+
+/**
+ *  Tell the delegate that a side begins to bring out.
+ *
+ *  @param side The side.
+ */
+- (void)notifyDelegateBeginsToBringOutSide:(MSSPSideDisplayed)side;
+
+/**
+ *  Tell the delegate that a side has been closed.
+ *
+ *  @param side The side.
+ */
+- (void)notifyDelegateHasClosedSide:(MSSPSideDisplayed)side;
+
+/**
+ *  Tell the delegate that a side has been opened.
+ *
+ *  @param side The side.
+ */
+- (void)notifyDelegateHasOpenedSide:(MSSPSideDisplayed)side;
+
+/**
+ *  Tell the delegate that a side will probably bring out.
+ *
+ *  @param side         The side.
+ *  @param timeInterval The estimated time before the panel is entirely visible.
+ */
+- (void)notifyDelegateWillProbablyBringOutSide:(MSSPSideDisplayed)side inTimeInterval:(NSTimeInterval)timeInterval;
+
+#pragma mark Batch updates
+/** @name Batch updates */
+
+/**
+ *  The completion blocks to execute once the batch updates are applied.
+ */
+@property (nonatomic, strong)   NSMutableArray              *batchCompletions;
+
+/**
+ *  The panel controllers set during the batch updates, indexed by side. A removed controller is represented by `NSNull`.
+ */
+@property (nonatomic, strong)   NSMutableDictionary         *batchPanelControllers;
+
+/**
+ *  The nesting level of the batch updates. The changes are collected while it is greater than 0.
+ */
+@property (nonatomic, assign)   NSUInteger                  batchUpdatesLevel;
+
+/**
+ *  The sides whose maximum width has been changed during the batch updates, as a combination of `MSSPSideMask()`.
+ */
+@property (nonatomic, assign)   NSUInteger                  batchWidthsChangedSides;
+
+/**
+ *  Apply the changes collected during the batch updates.
+ */
+- (void)commitBatchUpdates;
 
 #pragma mark Storyboard
 /** @name Storyboard */
@@ -388,53 +1233,180 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
 
 @implementation MSSlidingPanelCenterView
 
-#pragma mark Manage center view's touches
-/** @name Manage center view's touches */
+#pragma mark Initialization
+/** @name Initialization */
 
 /**
- *  Return the fartest descendant of the receiver that contains the specified point.
+ *  Initialize and return a new center view.
  *
- *  @param point The point.
- *  @param event The event.
+ *  @param frame The frame rectangle for the view.
  *
- *  @return The fartest descendant.
+ *  @return The initialized center view.
  */
-- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event
+- (id)initWithFrame:(CGRect)frame
 {
-    UIView  *hitView;
-    
-    hitView = [super hitTest:point withEvent:event];
+    self = [super initWithFrame:frame];
     
-    if ([[self slidingPanelController] sideDisplayed] == MSSPSideDisplayedLeft)
-    {
-        if ([[self slidingPanelController] leftPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNone)
-            return (nil);
-        
-        if ([[self slidingPanelController] leftPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNavBar && ![self navigationBarInSuperViewOfView:hitView])
-            return (nil);
-    }
-    else if ([[self slidingPanelController] sideDisplayed] == MSSPSideDisplayedRight)
+    if (self)
     {
-        if ([[self slidingPanelController] rightPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNone)
-            return (nil);
-        
-        if ([[self slidingPanelController] rightPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNavBar && ![self navigationBarInSuperViewOfView:hitView])
-            return (nil);
+        [self setDimmingLayer:[CALayer layer]];
+        [[self dimmingLayer] setZPosition:1];
+        [[self dimmingLayer] setOpacity:0];
+        [[self dimmingLayer] setHidden:YES];
+        [[self layer] addSublayer:[self dimmingLayer]];
+        [[self layer] setShadowOffset:CGSizeZero];
+        [self setEffectsSize:CGSizeZero];
     }
     
-    return (hitView);
+    return (self);
 }
 
+#pragma mark Depth effects
+/** @name Depth effects */
+
 /**
- *  Return the navigation bar object in view the view is included.
+ *  Lays out subviews. The shadow path and the dimming layer frame are only computed when the size of the view changes.
+ */
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+    
+    if (CGSizeEqualToSize([self bounds].size, [self effectsSize]))
+        return ;
+    
+    [self setEffectsSize:[self bounds].size];
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    [self updateShadowPath];
+    [[self dimmingLayer] setFrame:[self bounds]];
+    [CATransaction commit];
+}
+
+/**
+ *  Return the shadow path which follows the content of the view when its sublayers are transformed.
  *
- *  @param view The view.
+ *  @param transform The transformation of the sublayers.
  *
- *  @return The navigation bar object. It's value is `nil` if there is no superview which is a navigation bar.
+ *  @return The shadow path: the outline of the transformed bounds.
  */
-- (UINavigationBar *)navigationBarInSuperViewOfView:(UIView *)view
+- (UIBezierPath *)shadowPathWithSublayerTransform:(CATransform3D)transform
 {
-    UIView  *superView;
+    CGPoint         anchor;
+    CGRect          bounds;
+    CGPoint         corners[4];
+    NSUInteger      i;
+    UIBezierPath    *path;
+    
+    bounds = [self bounds];
+    
+    if (CATransform3DIsIdentity(transform))
+        return ([UIBezierPath bezierPathWithRect:bounds]);
+    
+    anchor = CGPointMake(CGRectGetMinX(bounds) + [[self layer] anchorPoint].x * bounds.size.width, CGRectGetMinY(bounds) + [[self layer] anchorPoint].y * bounds.size.height);
+    corners[0] = CGPointMake(CGRectGetMinX(bounds), CGRectGetMinY(bounds));
+    corners[1] = CGPointMake(CGRectGetMaxX(bounds), CGRectGetMinY(bounds));
+    corners[2] = CGPointMake(CGRectGetMaxX(bounds), CGRectGetMaxY(bounds));
+    corners[3] = CGPointMake(CGRectGetMinX(bounds), CGRectGetMaxY(bounds));
+    
+    path = [UIBezierPath bezierPath];
+    for (i = 0; i < 4; i++)
+    {
+        corners[i] = MSSPPointByApplyingTransform(CGPointMake(corners[i].x - anchor.x, corners[i].y - anchor.y), transform);
+        corners[i] = CGPointMake(corners[i].x + anchor.x, corners[i].y + anchor.y);
+        
+        if (i == 0)
+            [path moveToPoint:corners[i]];
+        else
+            [path addLineToPoint:corners[i]];
+    }
+    [path closePath];
+    
+    return (path);
+}
+
+/**
+ *  Set the shadow path for the current transformation of the sublayers.
+ */
+- (void)updateShadowPath
+{
+    [[self layer] setShadowPath:[[self shadowPathWithSublayerTransform:[[self layer] sublayerTransform]] CGPath]];
+}
+
+#pragma mark Manage center view's touches
+/** @name Manage center view's touches */
+
+/**
+ *  Return the fartest descendant of the receiver that contains the specified point.
+ *
+ *  @param point The point.
+ *  @param event The event.
+ *
+ *  @return The fartest descendant.
+ */
+- (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event
+{
+    UIView  *hitView;
+    
+    hitView = [super hitTest:[self contentPointWithPoint:point] withEvent:event];
+    
+    if ([[self slidingPanelController] sideDisplayed] == MSSPSideDisplayedLeft)
+    {
+        if ([[self slidingPanelController] leftPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNone)
+            return (nil);
+        
+        if ([[self slidingPanelController] leftPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNavBar && ![self navigationBarInSuperViewOfView:hitView])
+            return (nil);
+    }
+    else if ([[self slidingPanelController] sideDisplayed] == MSSPSideDisplayedRight)
+    {
+        if ([[self slidingPanelController] rightPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNone)
+            return (nil);
+        
+        if ([[self slidingPanelController] rightPanelCenterViewInteractionMode] == MSSPCenterViewInteractionNavBar && ![self navigationBarInSuperViewOfView:hitView])
+            return (nil);
+    }
+    
+    return (hitView);
+}
+
+/**
+ *  Return the point of the content displayed at a point of the view, when the sublayers are transformed by the reveal style.
+ *
+ *  @param point The point, in the coordinate system of the view.
+ *
+ *  @return The point of the untransformed content, in the coordinate system of the view.
+ */
+- (CGPoint)contentPointWithPoint:(CGPoint)point
+{
+    CGPoint         anchor;
+    CGRect          bounds;
+    CALayer         *layer;
+    CATransform3D   transform;
+    
+    layer = ([[self layer] presentationLayer] ?: [self layer]);
+    transform = [layer sublayerTransform];
+    
+    if (CATransform3DIsIdentity(transform))
+        return (point);
+    
+    bounds = [self bounds];
+    anchor = CGPointMake(CGRectGetMinX(bounds) + [layer anchorPoint].x * bounds.size.width, CGRectGetMinY(bounds) + [layer anchorPoint].y * bounds.size.height);
+    point = MSSPPointByInvertingTransform(CGPointMake(point.x - anchor.x, point.y - anchor.y), transform);
+    
+    return (CGPointMake(point.x + anchor.x, point.y + anchor.y));
+}
+
+/**
+ *  Return the navigation bar object in view the view is included.
+ *
+ *  @param view The view.
+ *
+ *  @return The navigation bar object. It's value is `nil` if there is no superview which is a navigation bar.
+ */
+- (UINavigationBar *)navigationBarInSuperViewOfView:(UIView *)view
+{
+    UIView  *superView;
     
     if ([view isKindOfClass:[UINavigationBar class]])
         return ((UINavigationBar *) view);
@@ -448,1149 +1420,3282 @@ typedef NS_ENUM(NSUInteger, MSSPPanTouchLocation)
         superView = [superView superview];
     }
     
-    return (nil);
+    return (nil);
+}
+
+@end
+
+@implementation MSSlidingPanelFrameMonitorTarget
+
+#pragma mark Frames
+/** @name Frames */
+
+/**
+ *  Called at each frame by the frame monitor.
+ *
+ *  @param displayLink The display link.
+ */
+- (void)frameMonitorFired:(CADisplayLink *)displayLink
+{
+    [[self slidingPanelController] frameMonitorFired:displayLink];
+}
+
+@end
+
+@implementation MSSlidingPanelController
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @return The intialized centrer view controller.
+ */
+- (id)init
+{
+    self = [super init];
+    
+    if (self)
+        [self commonSettings];
+    
+    return (self);
+}
+
+/**
+ *  Returns an object initialized from data in a given unarchiver.
+ *
+ *  @param aDecoder An unarchiver object.
+ *
+ *  @return self, initialized using the data in decoder.
+ */
+- (id)initWithCoder:(NSCoder *)aDecoder
+{
+    self = [super initWithCoder:aDecoder];
+    
+    if (self)
+        [self commonSettings];
+    
+    return (self);
+}
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @param nibNameOrNil   The nib name or nil.
+ *  @param nibBundleOrNil The bundle name or nil.
+ *
+ *  @return The initialized centrer view controller.
+ */
+- (id)initWithNibName:(NSString *)nibNameOrNil bundle:(NSBundle *)nibBundleOrNil
+{
+    self = [super initWithNibName:nibNameOrNil bundle:nibBundleOrNil];
+    
+    if (self)
+        [self commonSettings];
+    
+    return (self);
+}
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @param centerViewController The center view controller. Must not be `nil`.
+ *
+ *  @return The initialized centrer view controller.
+ */
+- (id)initWithCenterViewController:(UIViewController *)centerViewController
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self commonSettings];
+        [self setCenterViewController:centerViewController];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @param centerViewController The center view controller. Must not be `nil`.
+ *  @param leftPanelController  The left panel controller.
+ *
+ *  @return The initialized centrer view controller.
+ */
+- (id)initWithCenterViewController:(UIViewController *)centerViewController andLeftPanelController:(UIViewController *)leftPanelController
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self commonSettings];
+        [self setCenterViewController:centerViewController];
+        [self setLeftPanelController:leftPanelController];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @param centerViewController The center view controller. Must not be `nil`.
+ *  @param rightPanelController The right panel controller.
+ *
+ *  @return The initialized centrer view controller.
+ */
+- (id)initWithCenterViewController:(UIViewController *)centerViewController andRightPanelController:(UIViewController *)rightPanelController
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self commonSettings];
+        [self setCenterViewController:centerViewController];
+        [self setRightPanelController:rightPanelController];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Initialize and return a new sliding panel controller.
+ *
+ *  @param centerViewController The center view controller. Must not be `nil`.
+ *  @param leftPanelController  The left panel controller.
+ *  @param rightPanelController The right panel controller.
+ *
+ *  @return The initialized centrer view controller.
+ */
+- (id)initWithCenterViewController:(UIViewController *)centerViewController leftPanelController:(UIViewController *)leftPanelController andRightPanelController:(UIViewController *)rightPanelController
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self commonSettings];
+        [self setCenterViewController:centerViewController];
+        [self setLeftPanelController:leftPanelController];
+        [self setRightPanelController:rightPanelController];
+    }
+    
+    return (self);
+}
+
+#pragma mark Deallocation
+/** @name Deallocation */
+
+/**
+ *  Remove the stall observer and stop the frame monitor.
+ */
+- (void)dealloc
+{
+    [_frameMonitor invalidate];
+    
+    if (_stallObserver)
+    {
+        CFRunLoopObserverInvalidate(_stallObserver);
+        CFRelease(_stallObserver);
+    }
+}
+
+#pragma mark View life cycle
+/** @name View life cycle */
+
+/**
+ *  Creates the view that the controller manages.
+ */
+- (void)loadView
+{
+    CGSize  windowSize;
+    
+    [super loadView];
+    
+    windowSize = [[UIScreen mainScreen] bounds].size;
+    
+    if ([self storyboard])
+        [self setViewsFromStoryboard];
+    
+    [self setStatusBarView:[[UIView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, 20)]];
+    [[self statusBarView] setBackgroundColor:[self centerViewStatusBarColor]];
+    [[self statusBarView] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth)];
+    [[self statusBarView] setUserInteractionEnabled:NO];
+    [[[self statusBarView] layer] setZPosition:2];
+    
+    [self setCenterView:[[MSSlidingPanelCenterView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, windowSize.height)]];
+    [[self centerView] setSlidingPanelController:self];
+    [[[self centerViewController] view] setFrame:[[self centerView] frame]];
+    [[[self centerViewController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
+    [[self centerView] addSubview:[[self centerViewController] view]];
+    [[self centerView] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
+    [self applyCenterViewEffectsSettings];
+    
+    [self setView:[[UIView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, windowSize.height)]];
+    [[self view] addSubview:[self centerView]];
+    [[self view] addSubview:[self statusBarView]];
+    [[self view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
+    
+    [self setGestureRecognizers];
+    [self applyRevealStyle];
+    
+    if ([self sideDisplayedAtLoad] != MSSPSideDisplayedNone)
+    {
+        [self displaySideWithoutAnimation:[self sideDisplayedAtLoad]];
+        [self setSideDisplayedAtLoad:MSSPSideDisplayedNone];
+    }
+}
+
+/**
+ *  Notifies the view controller that its view is about to be added to a view hierarchy.
+ *
+ *  @param animated If YES, the view is being added to the window using an animation.
+ */
+- (void)viewWillAppear:(BOOL)animated
+{
+    [super viewWillAppear:animated];
+    
+    [self setViewVisible:YES];
+    [[self centerViewController] beginAppearanceTransition:YES animated:animated];
+    [self beginAppearanceTransitionOfPanelForSide:[self sideDisplayed] appearing:YES animated:animated];
+}
+
+/**
+ *  Notifies the view controller that its view was added to a view hierarchy.
+ *
+ *  @param animated If YES, the view was added to the window using an animation.
+ */
+- (void)viewDidAppear:(BOOL)animated
+{
+    [super viewDidAppear:animated];
+    
+    [[self centerViewController] endAppearanceTransition];
+    [self endAppearanceTransitionOfPanelForSide:[self sideDisplayed]];
+}
+
+/**
+ *  Notifies the view controller that its view is about to be removed from a view hierarchy.
+ *
+ *  @param animated If YES, the disappearance of the view is being animated.
+ */
+- (void)viewWillDisappear:(BOOL)animated
+{
+    [super viewWillDisappear:animated];
+    
+    [self setViewVisible:NO];
+    [[self centerViewController] beginAppearanceTransition:NO animated:animated];
+    [self beginAppearanceTransitionOfPanelForSide:MSSPSideDisplayedLeft appearing:NO animated:animated];
+    [self beginAppearanceTransitionOfPanelForSide:MSSPSideDisplayedRight appearing:NO animated:animated];
+}
+
+/**
+ *  Notifies the view controller that its view was removed from a view hierarchy.
+ *
+ *  @param animated If YES, the disappearance of the view was animated.
+ */
+- (void)viewDidDisappear:(BOOL)animated
+{
+    [super viewDidDisappear:animated];
+    
+    [[self centerViewController] endAppearanceTransition];
+    [self endAppearanceTransitionOfPanelForSide:MSSPSideDisplayedLeft];
+    [self endAppearanceTransitionOfPanelForSide:MSSPSideDisplayedRight];
+    [self stopFrameMonitor];
+}
+
+#pragma mark Tools
+/** @name Tools */
+
+/**
+ *  Add to a layer a keyframe animation of a property. Nothing is added if all the values are equal.
+ *
+ *  @param layer    The layer.
+ *  @param keyPath  The key path of the property.
+ *  @param values   The values of the keyframes, evenly spread over the duration.
+ *  @param duration The duration of the animation.
+ */
+- (void)addKeyframeAnimationToLayer:(CALayer *)layer forKeyPath:(NSString *)keyPath withValues:(NSArray *)values duration:(NSTimeInterval)duration
+{
+    CAKeyframeAnimation *animation;
+    
+    if (!layer || duration <= 0 || [[NSSet setWithArray:values] count] <= 1)
+        return ;
+    
+    animation = [CAKeyframeAnimation animationWithKeyPath:keyPath];
+    [animation setValues:values];
+    [animation setDuration:duration];
+    [self applyFrameRateRangeToAnimation:animation];
+    [layer addAnimation:animation forKey:keyPath];
+}
+
+/**
+ *  Adjust the status bar color.
+ */
+- (void)adjustStatusBarColor
+{
+    MSSPColorComponents color;
+    MSSPPanelEngine     engine;
+    UIColor             *statusBarColor;
+    
+    [self enterStallPhase:MSSPStallPhaseStatusBarUpdate];
+    
+    statusBarColor = [self statusBarColorForSide:[self sideDisplayed]];
+    
+    if ([self sideDisplayed] != MSSPSideDisplayedNone && [self statusBarDisplayedSmoothlyForSide:[self sideDisplayed]])
+    {
+        [self fillPanelEngine:&engine];
+        engine.centerStatusBarColor = MSSPColorComponentsWithColor([self centerViewStatusBarColor]);
+        engine.leftStatusBarColor = MSSPColorComponentsWithColor(statusBarColor);
+        engine.rightStatusBarColor = engine.leftStatusBarColor;
+        engine.leftStatusBarBlended = 1;
+        engine.rightStatusBarBlended = 1;
+        
+        color = MSSPPanelEngineStatusBarColor(&engine, [[self centerView] frame].origin.x, [self panelEngineDirection]);
+        [[self statusBarView] setBackgroundColor:[UIColor colorWithRed:color.red green:color.green blue:color.blue alpha:color.alpha]];
+    }
+    else
+        [[self statusBarView] setBackgroundColor:statusBarColor];
+    
+    [self exitStallPhase];
+}
+
+/**
+ *  Returns the animation duration for a given length.
+ *
+ *  @param length The length.
+ *
+ *  @return The duration.
+ */
+- (NSTimeInterval)animationDurationForLength:(CGFloat)length
+{
+    return (MSSPPanelEngineAnimationDuration(length, [self animationVelocity]));
+}
+
+/**
+ *  Set initial values to variables.
+ */
+- (void)commonSettings
+{
+    [self setBatchCompletions:[[NSMutableArray alloc] init]];
+    [self setBatchPanelControllers:[[NSMutableDictionary alloc] init]];
+    [self setBatchUpdatesLevel:0];
+    [self setBatchWidthsChangedSides:0];
+    
+    [self setTransitionCompletions:[[NSMutableArray alloc] init]];
+    [self setTransitionPending:NO];
+    [self setTransitionPendingAnimated:YES];
+    [self setTransitionPendingSide:MSSPSideDisplayedNone];
+    [self setTransitionRunning:NO];
+    
+    MSSPQualityGovernorInit(&_qualityGovernor, 1.0 / 60);
+    [self setAdaptiveQualityEnabled:NO];
+    [self setCenterViewSnapshot:nil];
+    [self setFrameMonitor:nil];
+    [self setFrameMonitorTimestamp:0];
+    [self setQualityLevel:MSSPQualityLevelFull];
+    [self setSlidesCount:0];
+    
+    MSSPFrameRateMeterInit(&_frameRateMeter);
+    [self setFrameRateRange:MSSPFrameRateRangeMake(80, 120, 120) forTransitionType:MSSPTransitionTypeInteractive];
+    [self setFrameRateRange:MSSPFrameRateRangeMake(80, 120, 120) forTransitionType:MSSPTransitionTypeSettle];
+    [self setFrameRateRange:MSSPFrameRateRangeMake(30, 60, 60) forTransitionType:MSSPTransitionTypeProgrammatic];
+    [self setFrameRateSink:nil];
+    [self setNextSlideType:MSSPTransitionTypeProgrammatic];
+    
+    MSSPPanTrackerInit(&_panTracker);
+    
+    MSSPStallMonitorInit(&_stallMonitor, g_stallThreshold);
+    [self setStallObserver:NULL];
+    [self setStallSink:nil];
+    [self setStallThreshold:g_stallThreshold];
+    [self setStallWatchdogEnabled:NO];
+    
+    _centerViewController = nil;
+    [self setCenterViewStatusBarColor:[UIColor clearColor]];
+    [self setCenterViewDimmingColor:[UIColor blackColor]];
+    [self setCenterViewDimmingOpacity:0];
+    [self setCenterViewShadowColor:[UIColor blackColor]];
+    [self setCenterViewShadowOpacity:0];
+    [self setCenterViewShadowRadius:g_centerViewShadowRadius];
+    
+    [self setLeftPanelCenterViewInteractionMode:MSSPCenterViewInteractionNavBar];
+    [self setLeftPanelCloseGestureMode:MSSPCloseGestureModeAll];
+    [self setLeftPanelController:nil];
+    [self setLeftPanelMaximumWidth:g_panelMaximumWidth];
+    [self setLeftPanelOpenGestureMode:MSSPOpenGestureModeAll];
+    [self setLeftPanelStatusBarColor:[UIColor clearColor]];
+    [self setLeftPanelStatusBarDisplayedSmoothly:NO];
+    
+    [self setRightPanelCenterViewInteractionMode:MSSPCenterViewInteractionNavBar];
+    [self setRightPanelCloseGestureMode:MSSPCloseGestureModeAll];
+    [self setRightPanelController:nil];
+    [self setRightPanelMaximumWidth:g_panelMaximumWidth];
+    [self setRightPanelOpenGestureMode:MSSPOpenGestureModeAll];
+    [self setRightPanelStatusBarColor:[UIColor clearColor]];
+    [self setRightPanelStatusBarDisplayedSmoothly:NO];
+ 
+    [self setAnimationCurve:MSSPCurveEaseInOut];
+    [self setAnimationVelocity:g_animationVelocity];
+    [self setKeepsPanelsLoaded:NO];
+    [self setPanelSwitchHysteresis:0];
+    [self setPanRubberBandEnabled:NO];
+    [self setPanDirectionLockEnabled:NO];
+    [self setPanDirectionLockAngle:g_panDirectionLockAngle];
+    [self setPanDirectionLockDistance:g_panDirectionLockDistance];
+    [self setPanDirectionLocked:NO];
+    [self setPanSliding:NO];
+    [self setPanOwnerTouch:nil];
+    [self setInteractiveRevealSide:MSSPSideDisplayedNone];
+    [self setInteractiveRevealStartSide:MSSPSideDisplayedNone];
+    [self setLeftPanelAppearanceState:MSSPAppearanceStateDisappeared];
+    [self setRightPanelAppearanceState:MSSPAppearanceStateDisappeared];
+    [self setViewVisible:NO];
+    [self setHandoffScrollView:nil];
+    [self setPanHandoffFollowing:NO];
+    [self setScrollViewHandoffEnabled:NO];
+    [self setRevealHintEdgeWidth:g_revealHintEdgeWidth];
+    [self setRevealHintSides:0];
+    [self setRevealParametersApplied:NO];
+    [self setRevealStyle:MSSPRevealStyleRevealUnder];
+    [self setSideDisplayed:MSSPSideDisplayedNone];
+    [self setSideDisplayedAtLoad:MSSPSideDisplayedNone];
+}
+
+/**
+ *  Find every navigation bar in a view.
+ *
+ *  @param navigationBarList A array which contains the list of every navigation bar found. Must be initialized.
+ *  @param view              The view.
+ */
+- (void)fillNavigationBarsList:(NSMutableArray *)navigationBarList withSubviewsOfView:(UIView *)view
+{
+    UIView  *subview;
+    
+    if ([view isKindOfClass:[UINavigationBar class]])
+        [navigationBarList addObject:view];
+    
+    for (subview in [view subviews])
+        [self fillNavigationBarsList:navigationBarList withSubviewsOfView:subview];
+}
+
+/**
+ *  The percentage visible of the current panel displayed.
+ *
+ *  @return The percentage.
+ */
+- (CGFloat)percentageVisibleOfDisplayedPanel
+{
+    MSSPPanelEngine engine;
+    
+    [self fillPanelEngine:&engine];
+    
+    return (MSSPPanelEngineFraction(&engine, [[self centerView] frame].origin.x, [self panelEngineDirection]));
+}
+
+#pragma mark Center view effects
+/** @name Center view effects */
+
+/**
+ *  Add to a layer an animation between two opacity values, following the animation curve.
+ *
+ *  @param layer     The layer.
+ *  @param keyPath   The key path of the opacity.
+ *  @param fromValue The opacity at the beginning of the animation.
+ *  @param toValue   The opacity at the end of the animation.
+ *  @param duration  The duration of the animation.
+ */
+- (void)addOpacityAnimationToLayer:(CALayer *)layer forKeyPath:(NSString *)keyPath fromValue:(float)fromValue toValue:(float)toValue withDuration:(NSTimeInterval)duration
+{
+    NSUInteger      i;
+    NSMutableArray  *values;
+    
+    values = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    for (i = 0; i <= g_animationKeyframesCount; i++)
+        [values addObject:@(fromValue + (toValue - fromValue) * MSSPCurveEvaluate([self animationCurve], (double)i / g_animationKeyframesCount))];
+    
+    [self addKeyframeAnimationToLayer:layer forKeyPath:keyPath withValues:values duration:duration];
+}
+
+/**
+ *  Apply the shadow and dimming settings to the center view.
+ */
+- (void)applyCenterViewEffectsSettings
+{
+    if (![self centerView])
+        return ;
+    
+    [[[self centerView] layer] setShadowColor:[[self centerViewShadowColor] CGColor]];
+    [[[self centerView] layer] setShadowRadius:[self centerViewShadowRadius]];
+    [[[self centerView] dimmingLayer] setBackgroundColor:[[self centerViewDimmingColor] CGColor]];
+    
+    [self setCenterViewEffectsFraction:[self percentageVisibleOfDisplayedPanel] withDuration:0];
+}
+
+/**
+ *  Set the color of the overlay which dims the center view.
+ *
+ *  @param centerViewDimmingColor The color.
+ */
+- (void)setCenterViewDimmingColor:(UIColor *)centerViewDimmingColor
+{
+    _centerViewDimmingColor = centerViewDimmingColor;
+    [self applyCenterViewEffectsSettings];
+}
+
+/**
+ *  Set the opacity of the dimming overlay when a panel is entirely displayed.
+ *
+ *  @param centerViewDimmingOpacity The opacity.
+ */
+- (void)setCenterViewDimmingOpacity:(CGFloat)centerViewDimmingOpacity
+{
+    _centerViewDimmingOpacity = centerViewDimmingOpacity;
+    [self applyCenterViewEffectsSettings];
+}
+
+/**
+ *  Set the shadow and dimming opacities of the center view for a visible part of the displayed panel.
+ *
+ *  @param fraction The visible part of the displayed panel, between 0 and 1.
+ *  @param duration The duration of the change. 0 changes the opacities immediately.
+ */
+- (void)setCenterViewEffectsFraction:(CGFloat)fraction withDuration:(NSTimeInterval)duration
+{
+    CALayer *dimmingLayer;
+    float   dimmingOpacity;
+    CALayer *shadowLayer;
+    float   shadowOpacity;
+    
+    if (![self centerView])
+        return ;
+    
+    fraction = MAX(0, MIN(1, fraction));
+    
+    dimmingLayer = [[self centerView] dimmingLayer];
+    dimmingOpacity = [self centerViewDimmingOpacity] * fraction;
+    shadowLayer = [[self centerView] layer];
+    shadowOpacity = ([self qualityLevel] >= MSSPQualityLevelNoShadow ? 0 : [self centerViewShadowOpacity] * fraction);
+    
+    if ([shadowLayer shadowOpacity] == shadowOpacity && [dimmingLayer opacity] == dimmingOpacity)
+        return ;
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    
+    if ([shadowLayer shadowOpacity] != shadowOpacity)
+    {
+        if (duration > 0)
+            [self addOpacityAnimationToLayer:shadowLayer forKeyPath:@"shadowOpacity" fromValue:[([shadowLayer presentationLayer] ?: shadowLayer) shadowOpacity] toValue:shadowOpacity withDuration:duration];
+        
+        [shadowLayer setShadowOpacity:shadowOpacity];
+    }
+    
+    if ([dimmingLayer opacity] != dimmingOpacity)
+    {
+        if (duration > 0)
+            [self addOpacityAnimationToLayer:dimmingLayer forKeyPath:@"opacity" fromValue:[([dimmingLayer presentationLayer] ?: dimmingLayer) opacity] toValue:dimmingOpacity withDuration:duration];
+        
+        [dimmingLayer setOpacity:dimmingOpacity];
+        [dimmingLayer setHidden:(dimmingOpacity <= 0 && duration <= 0)];
+    }
+    
+    [CATransaction commit];
+}
+
+/**
+ *  Set the color of the center view shadow.
+ *
+ *  @param centerViewShadowColor The color.
+ */
+- (void)setCenterViewShadowColor:(UIColor *)centerViewShadowColor
+{
+    _centerViewShadowColor = centerViewShadowColor;
+    [self applyCenterViewEffectsSettings];
+}
+
+/**
+ *  Set the opacity of the center view shadow when a panel is entirely displayed.
+ *
+ *  @param centerViewShadowOpacity The opacity.
+ */
+- (void)setCenterViewShadowOpacity:(CGFloat)centerViewShadowOpacity
+{
+    _centerViewShadowOpacity = centerViewShadowOpacity;
+    [self applyCenterViewEffectsSettings];
+}
+
+/**
+ *  Set the blur radius of the center view shadow.
+ *
+ *  @param centerViewShadowRadius The radius.
+ */
+- (void)setCenterViewShadowRadius:(CGFloat)centerViewShadowRadius
+{
+    _centerViewShadowRadius = centerViewShadowRadius;
+    [self applyCenterViewEffectsSettings];
+}
+
+#pragma mark Reveal style
+/** @name Reveal style */
+
+/**
+ *  Add to the center view, the displayed panel and the status bar the animations of the reveal style toward a position of the center view. The final values are applied immediately.
+ *
+ *  @param originX  The horizontal position of the center view at the end of the animation.
+ *  @param duration The duration of the animation.
+ */
+- (void)addRevealStyleAnimationsToOriginX:(CGFloat)originX withDuration:(NSTimeInterval)duration
+{
+    NSMutableArray          *centerOpacities;
+    NSMutableArray          *centerTransforms;
+    CGFloat                 fromX;
+    NSUInteger              i;
+    MSSPRevealParameters    parameters;
+    CALayer                 *panelLayer;
+    NSMutableArray          *panelOpacities;
+    NSMutableArray          *panelTransforms;
+    NSMutableArray          *shadowPaths;
+    NSMutableArray          *statusBarOpacities;
+    
+    if (![self centerView])
+        return ;
+    
+    fromX = [[self centerView] frame].origin.x;
+    centerOpacities = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    centerTransforms = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    panelOpacities = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    panelTransforms = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    shadowPaths = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    statusBarOpacities = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    
+    for (i = 0; i <= g_animationKeyframesCount; i++)
+    {
+        [self evaluateRevealStyleForCenterViewOriginX:(fromX + (originX - fromX) * MSSPCurveEvaluate([self animationCurve], (double)i / g_animationKeyframesCount)) parameters:&parameters];
+        [centerOpacities addObject:@(parameters.center.opacity)];
+        [centerTransforms addObject:[NSValue valueWithCATransform3D:MSSPTransformWithRevealLayerParameters(&parameters.center)]];
+        [shadowPaths addObject:(__bridge id)[[[self centerView] shadowPathWithSublayerTransform:MSSPTransformWithRevealLayerParameters(&parameters.center)] CGPath]];
+        [panelOpacities addObject:@(parameters.panel.opacity)];
+        [panelTransforms addObject:[NSValue valueWithCATransform3D:MSSPTransformWithRevealLayerParameters(&parameters.panel)]];
+        [statusBarOpacities addObject:@(parameters.statusBarOpacity)];
+    }
+    
+    [self applyRevealParameters:&parameters];
+    
+    panelLayer = ([self sideDisplayed] != MSSPSideDisplayedNone ? [[[self panelControllerForSide:[self sideDisplayed]] view] layer] : nil);
+    
+    [self addKeyframeAnimationToLayer:[[self centerView] layer] forKeyPath:@"opacity" withValues:centerOpacities duration:duration];
+    [self addKeyframeAnimationToLayer:[[self centerView] layer] forKeyPath:@"sublayerTransform" withValues:centerTransforms duration:duration];
+    [self addKeyframeAnimationToLayer:[[self centerView] layer] forKeyPath:@"shadowPath" withValues:shadowPaths duration:duration];
+    [self addKeyframeAnimationToLayer:panelLayer forKeyPath:@"opacity" withValues:panelOpacities duration:duration];
+    [self addKeyframeAnimationToLayer:panelLayer forKeyPath:@"transform" withValues:panelTransforms duration:duration];
+    [self addKeyframeAnimationToLayer:[[self statusBarView] layer] forKeyPath:@"opacity" withValues:statusBarOpacities duration:duration];
+}
+
+/**
+ *  Apply reveal parameters to the center view, the displayed panel and the status bar, in one transaction. Nothing is done if they are already applied.
+ *
+ *  @param parameters The parameters.
+ */
+- (void)applyRevealParameters:(const MSSPRevealParameters *)parameters
+{
+    CALayer *panelLayer;
+    
+    if ([self revealParametersApplied] && MSSPRevealParametersEqual(&_revealParameters, parameters))
+        return ;
+    
+    _revealParameters = *parameters;
+    [self setRevealParametersApplied:YES];
+    
+    panelLayer = ([self sideDisplayed] != MSSPSideDisplayedNone ? [[[self panelControllerForSide:[self sideDisplayed]] view] layer] : nil);
+    
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    [[[self centerView] layer] setOpacity:parameters->center.opacity];
+    [[[self centerView] layer] setSublayerTransform:MSSPTransformWithRevealLayerParameters(&parameters->center)];
+    [[self centerView] updateShadowPath];
+    [panelLayer setOpacity:parameters->panel.opacity];
+    [panelLayer setTransform:MSSPTransformWithRevealLayerParameters(&parameters->panel)];
+    [panelLayer setZPosition:(parameters->panelInFront ? 1 : 0)];
+    [[[self statusBarView] layer] setOpacity:parameters->statusBarOpacity];
+    [CATransaction commit];
+}
+
+/**
+ *  Apply the reveal style for the current position of the center view.
+ */
+- (void)applyRevealStyle
+{
+    MSSPRevealParameters    parameters;
+    
+    if (![self centerView])
+        return ;
+    
+    [self evaluateRevealStyleForCenterViewOriginX:[[self centerView] frame].origin.x parameters:&parameters];
+    [self applyRevealParameters:&parameters];
+}
+
+/**
+ *  Evaluate the reveal style for a position of the center view.
+ *
+ *  @param originX    The horizontal position of the center view.
+ *  @param parameters The parameters to fill.
+ */
+- (void)evaluateRevealStyleForCenterViewOriginX:(CGFloat)originX parameters:(MSSPRevealParameters *)parameters
+{
+    MSSPPanelEngine engine;
+    MSSPRevealInput input;
+    
+    [self fillPanelEngine:&engine];
+    MSSPPanelEngineRevealInput(&engine, originX, [self panelEngineDirection], &input);
+    MSSPRevealStyleEvaluate(engine.revealStyleEvaluator, &input, parameters);
+}
+
+/**
+ *  Remove the reveal style of a panel view, when it isn't displayed anymore.
+ *
+ *  @param panelView The view of the panel.
+ */
+- (void)resetRevealStyleOfPanelView:(UIView *)panelView
+{
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+    [[panelView layer] setOpacity:1];
+    [[panelView layer] setTransform:CATransform3DIdentity];
+    [[panelView layer] setZPosition:0];
+    [CATransaction commit];
+    
+    [self setRevealParametersApplied:NO];
+}
+
+/**
+ *  Set the built-in reveal style.
+ *
+ *  @param revealStyle The style.
+ */
+- (void)setRevealStyle:(MSSPRevealStyle)revealStyle
+{
+    _revealStyle = revealStyle;
+    [self setRevealStyleEvaluator:MSSPRevealStyleGetEvaluator(revealStyle)];
+}
+
+/**
+ *  Set the function which evaluates the reveal style.
+ *
+ *  @param revealStyleEvaluator The function.
+ */
+- (void)setRevealStyleEvaluator:(MSSPRevealStyleEvaluator)revealStyleEvaluator
+{
+    _revealStyleEvaluator = revealStyleEvaluator;
+    [self applyRevealStyle];
+}
+
+#pragma mark Set center view and panels
+/** @name Set center view and panels */
+
+/**
+ *  Set the center view controller value.
+ *
+ *  @param centerViewController The center view controller. Must not be nil.
+ */
+- (void)setCenterViewController:(UIViewController *)centerViewController
+{
+    CGRect  frame;
+    
+    NSParameterAssert(centerViewController);
+    
+    if ([self isViewLoaded])
+#ifndef __clang_analyzer__
+        frame = [[[self centerViewController] view] frame];
+#endif
+    
+    if ([self viewVisible])
+        [[self centerViewController] beginAppearanceTransition:NO animated:NO];
+    
+    [[[self centerViewController] view] removeFromSuperview];
+    
+    if ([self viewVisible])
+        [[self centerViewController] endAppearanceTransition];
+    
+    [[self centerViewController] removeFromParentViewController];
+    
+    _centerViewController = centerViewController;
+    
+    [self addChildViewController:[self centerViewController]];
+    [[self centerViewController] didMoveToParentViewController:self];
+    
+    if ([self isViewLoaded])
+    {
+#ifndef __clang_analyzer__
+        [[[self centerViewController] view] setFrame:frame];
+#endif
+        [[[self centerViewController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
+        
+        if ([self viewVisible])
+            [[self centerViewController] beginAppearanceTransition:YES animated:NO];
+        
+        [[self centerView] addSubview:[[self centerViewController] view]];
+        
+        if ([self viewVisible])
+            [[self centerViewController] endAppearanceTransition];
+    }
+}
+
+/**
+ *  Set the left panel controller value.
+ *
+ *  @param leftPanelController The left panel controller.
+ */
+- (void)setLeftPanelController:(UIViewController *)leftPanelController
+{
+    [self setPanelController:leftPanelController forSide:MSSPSideDisplayedLeft];
+}
+
+/**
+ *  Set a panel controller for a side.
+ *
+ *  @param panelController The panel controller.
+ *  @param side            The side. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)setPanelController:(UIViewController *)panelController forSide:(MSSPSideDisplayed)side
+{
+    __block BOOL                        reloadPanel;
+    void                                (^setController)(void);
+    __weak MSSlidingPanelController     *weakSelf;
+    
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    weakSelf = self;
+    
+    if ([self batchUpdatesLevel] > 0)
+    {
+        [[self batchPanelControllers] setObject:(panelController ? panelController : [NSNull null]) forKey:@(side)];
+        return ;
+    }
+    
+    reloadPanel = NO;
+    setController = ^(void)
+    {
+        MSSlidingPanelController    *strongSelf;
+        
+        if (!(strongSelf = weakSelf))
+            return ;
+        
+        [strongSelf beginAppearanceTransitionOfPanelForSide:side appearing:NO animated:NO];
+        [strongSelf endAppearanceTransitionOfPanelForSide:side];
+        
+        if ([[strongSelf panelControllerForSide:side] isViewLoaded] && [[[strongSelf panelControllerForSide:side] view] superview] == [strongSelf view])
+        {
+            [[[strongSelf panelControllerForSide:side] view] removeFromSuperview];
+            [[[strongSelf panelControllerForSide:side] view] setHidden:NO];
+        }
+        
+        [[strongSelf panelControllerForSide:side] removeFromParentViewController];
+        
+        if (side == MSSPSideDisplayedLeft)
+            strongSelf->_leftPanelController = panelController;
+        else
+            strongSelf->_rightPanelController = panelController;
+        
+        if (!panelController)
+            return ;
+        
+        [strongSelf addChildViewController:panelController];
+        [[strongSelf panelControllerForSide:side] didMoveToParentViewController:strongSelf];
+        
+        if (reloadPanel)
+        {
+            [strongSelf loadPanelForSide:side];
+            [strongSelf applyRevealStyle];
+        }
+        else if ([strongSelf keepsPanelsLoaded] && [strongSelf isViewLoaded])
+            [strongSelf installPanelViewForSide:side];
+    };
+    
+    if ([self isViewLoaded] && [self sideDisplayed] == side)
+    {
+        if (!panelController)
+        {
+            [self enqueueTransitionToSide:MSSPSideDisplayedNone animated:YES withCompletion:^(MSSPTransitionResult __unused result)
+             {
+                 setController();
+             }];
+            return ;
+        }
+        else
+        {
+            [self unloadPanelForSide:side];
+            reloadPanel = YES;
+        }
+    }
+    
+    setController();
+}
+
+/**
+ *  Set the right panel controller value.
+ *
+ *  @param rightPanelController The right panel controller.
+ */
+- (void)setRightPanelController:(UIViewController *)rightPanelController
+{
+    [self setPanelController:rightPanelController forSide:MSSPSideDisplayedRight];
+}
+
+#pragma mark Panels settings
+/** @name Panels settings */
+
+/**
+ *  Set if the panels' views stay in the view hierarchy once loaded.
+ *
+ *  @param keepsPanelsLoaded YES to keep the views in the view hierarchy, else NO.
+ */
+- (void)setKeepsPanelsLoaded:(BOOL)keepsPanelsLoaded
+{
+    UIViewController    *panelController;
+    MSSPSideDisplayed   side;
+    
+    _keepsPanelsLoaded = keepsPanelsLoaded;
+    
+    if (keepsPanelsLoaded || ![self isViewLoaded])
+        return ;
+    
+    for (side = MSSPSideDisplayedLeft; side <= MSSPSideDisplayedRight; side++)
+    {
+        panelController = [self panelControllerForSide:side];
+        
+        if (side == [self sideDisplayed] || ![panelController isViewLoaded])
+            continue ;
+        
+        if ([[panelController view] superview] == [self view])
+        {
+            [[panelController view] removeFromSuperview];
+            [[panelController view] setHidden:NO];
+        }
+    }
+}
+
+/**
+ *  Set the maximum width of the left panel.
+ *
+ *  @param leftPanelMaximumWidth Left panel's maximum width.
+ */
+- (void)setLeftPanelMaximumWidth:(CGFloat)leftPanelMaximumWidth
+{
+    [self setLeftPanelMaximumWidth:leftPanelMaximumWidth withCompletion:nil];
+}
+
+/**
+ *  Set the maximum width of the left panel with.
+ *
+ *  @param maximumWidth Panel's maximum width.
+ *  @param completion   A block object to be executed when the maximum width is set.
+ */
+- (void)setLeftPanelMaximumWidth:(CGFloat)leftPanelMaximumWidth withCompletion:(void (^)(void))completion
+{
+    [self setPanelMaximumWidth:leftPanelMaximumWidth forSide:MSSPSideDisplayedLeft withCompletion:completion];
+}
+
+/**
+ *  Set the maximum width of a panel.
+ *
+ *  @param panelMaximumWidth Panel's maximum width.
+ *  @param side              The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param completion        A block object to be executed when the maximum width is set.
+ */
+- (void)setPanelMaximumWidth:(CGFloat)panelMaximumWidth forSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion
+{
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (panelMaximumWidth < 0)
+        panelMaximumWidth = 0;
+    
+    if (panelMaximumWidth > [[UIScreen mainScreen] bounds].size.width)
+        panelMaximumWidth = [[UIScreen mainScreen] bounds].size.width;
+    
+    if (side == MSSPSideDisplayedLeft)
+        _leftPanelMaximumWidth = panelMaximumWidth;
+    else
+        _rightPanelMaximumWidth = panelMaximumWidth;
+    
+    if ([self batchUpdatesLevel] > 0)
+    {
+        [self setBatchWidthsChangedSides:[self batchWidthsChangedSides] | MSSPSideMask(side)];
+        
+        if (completion)
+            [[self batchCompletions] addObject:[completion copy]];
+        
+        return ;
+    }
+    
+    if ([self sideDisplayed] == side)
+    {
+        [self enqueueTransitionToSide:side animated:YES withCompletion:^(MSSPTransitionResult __unused result)
+         {
+             if (completion)
+                 completion();
+         }];
+    }
+    else if (completion)
+        completion();
+}
+
+/**
+ *  Set the maximum width of the right panel.
+ *
+ *  @param rightPanelMaximumWidth Right panel's maximum width.
+ */
+- (void)setRightPanelMaximumWidth:(CGFloat)rightPanelMaximumWidth
+{
+    [self setRightPanelMaximumWidth:rightPanelMaximumWidth withCompletion:nil];
+}
+
+/**
+ *  Set the maximum width of the right panel with.
+ *
+ *  @param maximumWidth Panel's maximum width.
+ *  @param completion   A block object to be executed when the maximum width is set.
+ */
+- (void)setRightPanelMaximumWidth:(CGFloat)rightPanelMaximumWidth withCompletion:(void (^)(void))completion
+{
+    [self setPanelMaximumWidth:rightPanelMaximumWidth forSide:MSSPSideDisplayedRight withCompletion:completion];
+}
+
+/**
+ *  Stretch the displayed panel so it fills the space uncovered by the center view when this one is dragged beyond the maximum width of the panel.
+ *
+ *  @param originX The horizontal position of the center view.
+ */
+- (void)stretchDisplayedPanelToCenterViewOriginX:(CGFloat)originX
+{
+    CGRect              frame;
+    UIViewController    *panelController;
+    
+    if ([self sideDisplayed] == MSSPSideDisplayedNone || !(panelController = [self panelControllerForSide:[self sideDisplayed]]))
+        return ;
+    
+    frame = [[panelController view] frame];
+    
+    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
+        frame.size.width = MAX([self leftPanelMaximumWidth], originX);
+    else
+    {
+        frame.size.width = MAX([self rightPanelMaximumWidth], -originX);
+        frame.origin.x = [[self view] bounds].size.width - frame.size.width;
+    }
+    
+    if (!CGRectEqualToRect(frame, [[panelController view] frame]))
+        [[panelController view] setFrame:frame];
+}
+
+#pragma mark Panels information
+/** @name Panels information */
+
+/**
+ *  Return the panel controller for a side.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return The panel controller.
+ */
+- (UIViewController *)panelControllerForSide:(MSSPSideDisplayed)side
+{
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (side == MSSPSideDisplayedLeft)
+        return ([self leftPanelController]);
+    else
+        return ([self rightPanelController]);
+}
+
+/**
+ *  Return the panel maximum width for a side.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return The panel maximum width.
+ */
+- (NSUInteger)panelMaximumWithForSide:(MSSPSideDisplayed)side
+{
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (side == MSSPSideDisplayedLeft)
+        return ([self leftPanelMaximumWidth]);
+    else
+        return ([self rightPanelMaximumWidth]);
+}
+
+/**
+ *  Return the status bar color for a side.
+ *
+ *  @param side The side.
+ *
+ *  @return The status bar color.
+ */
+- (UIColor *)statusBarColorForSide:(MSSPSideDisplayed)side
+{
+    if (side == MSSPSideDisplayedLeft)
+        return ([self leftPanelStatusBarColor]);
+    else if (side == MSSPSideDisplayedRight)
+        return ([self rightPanelStatusBarColor]);
+    
+    return ([self centerViewStatusBarColor]);
+}
+
+/**
+ *  Return if the status bar must be displayed smoothly for a side.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return YES if the status bar must be displayed smoothly, else NO.
+ */
+- (BOOL)statusBarDisplayedSmoothlyForSide:(MSSPSideDisplayed)side
+{
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if ([self qualityLevel] >= MSSPQualityLevelSnapStatusBar)
+        return (NO);
+    
+    if (side == MSSPSideDisplayedLeft)
+        return ([self leftPanelStatusBarDisplayedSmoothly]);
+
+    return ([self rightPanelStatusBarDisplayedSmoothly]);
+}
+
+#pragma mark Manage gestures
+/** @name Manage gestures */
+
+/**
+ *  Ask the delegate if a gesture recognizer should receive an object representing a touch.
+ *
+ *  @param gestureRecognizer The gesture recognizer.
+ *  @param touch             The touch.
+ *
+ *  @return YES (the default) to allow the gesture recognizer to examine the touch object, NO to prevent the gesture recognizer from seeing this touch object.
+ */
+- (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldReceiveTouch:(UITouch *)touch
+{
+    MSSPOpenGestureMode openGestureMode;
+    BOOL                receive;
+    
+    if (gestureRecognizer == [self panGestureRecognizer])
+    {
+        if (![self panOwnerTouch] || [[self panOwnerTouch] phase] == UITouchPhaseEnded || [[self panOwnerTouch] phase] == UITouchPhaseCancelled)
+            MSSPPanTrackerReleaseTouch(&_panTracker);
+        
+        if (!MSSPPanTrackerCanClaimTouch(&_panTracker, (uintptr_t)(__bridge void *)touch))
+            return (NO);
+    }
+    
+    openGestureMode = MSSPOpenGestureModeNone;
+    
+    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
+        receive = (([self leftPanelCloseGestureMode] & [self closeGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch]) > 0);
+    else if ([self sideDisplayed] == MSSPSideDisplayedRight)
+        receive = (([self rightPanelCloseGestureMode] & [self closeGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch]) > 0);
+    else
+    {
+        openGestureMode = [self openGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch];
+        receive = ((([self leftPanelController] != nil) && (([self leftPanelOpenGestureMode] & openGestureMode) > 0)) ||
+                   (([self rightPanelController] != nil) && (([self rightPanelOpenGestureMode] & openGestureMode) > 0)));
+    }
+    
+    // A refused touch must neither own the pan nor change the handoff of the running one.
+    if (!receive || gestureRecognizer != [self panGestureRecognizer])
+        return (receive);
+    
+    MSSPPanTrackerClaimTouch(&_panTracker, (uintptr_t)(__bridge void *)touch);
+    
+    if (!_panTracker.tracking)
+    {
+        [self setRevealHintSides:0];
+        [self setHandoffScrollView:[self handoffScrollViewForTouch:touch]];
+    }
+    
+    [self setPanOwnerTouch:touch];
+    
+    if (openGestureMode != MSSPOpenGestureModeNone)
+        [self hintRevealWithTouch:touch];
+    
+    return (YES);
+}
+
+/**
+ *  Asks the delegate if a gesture recognizer should begin interpreting touches.
+ *
+ *  @param gestureRecognizer The gesture recognizer.
+ *
+ *  @return YES (the default) to tell the gesture recognizer to proceed with interpreting touches, NO to prevent it from attempting to recognize its gesture.
+ */
+- (BOOL)gestureRecognizerShouldBegin:(UIGestureRecognizer *)gestureRecognizer
+{
+    CGPoint direction;
+    
+    if ((gestureRecognizer == [self panGestureRecognizer] || gestureRecognizer == [self tapGestureRecognizer]) && [self interactiveRevealSide] != MSSPSideDisplayedNone)
+        return (NO);
+    
+    if (gestureRecognizer != [self panGestureRecognizer] || (![self panDirectionLockEnabled] && ![self handoffScrollView]))
+        return (YES);
+    
+    direction = [[self panGestureRecognizer] velocityInView:[self view]];
+    
+    if (direction.x == 0 && direction.y == 0)
+        direction = [[self panGestureRecognizer] translationInView:[self view]];
+    
+    return (MSSPPanelEngineIsPanHorizontal(direction.x, direction.y, [self panDirectionLockAngle]));
+}
+
+/**
+ *  Asks the delegate if two gesture recognizers should be allowed to recognize gestures simultaneously.
+ *
+ *  @param gestureRecognizer      An instance of a subclass of the abstract base class UIGestureRecognizer. This is the object sending the message to the delegate.
+ *  @param otherGestureRecognizer An instance of a subclass of the abstract base class UIGestureRecognizer.
+ *
+ *  @return YES to allow both gestureRecognizer and otherGestureRecognizer to recognize their gestures simultaneously. The default implementation returns NO—no two gestures can be recognized simultaneously.
+ */
+- (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldRecognizeSimultaneouslyWithGestureRecognizer:(UIGestureRecognizer *)otherGestureRecognizer
+{
+    // The panning follows the handoff scroll view until it reaches its content edge.
+    if (gestureRecognizer == [self panGestureRecognizer] && [self handoffScrollView] && otherGestureRecognizer == [[self handoffScrollView] panGestureRecognizer])
+        return (YES);
+    
+    if ([[self delegate] respondsToSelector:@selector(slidingPanelController:gestureRecognizer:shouldRecognizeSimultaneouslyWithGestureRecognizer:)])
+        return ([[self delegate] slidingPanelController:self gestureRecognizer:gestureRecognizer shouldRecognizeSimultaneouslyWithGestureRecognizer:otherGestureRecognizer]);
+    
+    return (NO);
+}
+
+/**
+ *  Return the list of the possible closing gestures recognized.
+ *
+ *  @param gestureRecognizer The gesture recognizer.
+ *  @param touch             The touch.
+ *
+ *  @return The closing gestures possibly recognized.
+ */
+- (MSSPCloseGestureMode)closeGestureModeWithGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer andTouch:(UITouch *)touch
+{
+    MSSPCloseGestureMode    closeGestureMode;
+    NSMutableArray          *navigationBarList;
+    UIScrollView            *scrollView;
+    
+    if (![self isTouchInCenterView:touch])
+    {
+        if (gestureRecognizer != [self panGestureRecognizer] || !(scrollView = [self handoffScrollViewForTouch:touch]) ||
+            ![scrollView isDescendantOfView:[[self panelControllerForSide:[self sideDisplayed]] view]])
+            return (MSSPCloseGestureModeNone);
+        
+        [self setPanTouchLocation:MSSPPanTouchLocationContent];
+        
+        return (MSSPCloseGestureModePanContent);
+    }
+    
+    closeGestureMode = MSSPCloseGestureModeNone;
+    navigationBarList = [[NSMutableArray alloc] init];
+    [self fillNavigationBarsList:navigationBarList withSubviewsOfView:[self centerView]];
+    
+    if (gestureRecognizer == [self tapGestureRecognizer])
+    {
+        if ([self isTouch:touch inNavigationBars:navigationBarList])
+            closeGestureMode |= MSSPCloseGestureModeTapNavBar;
+        else
+            closeGestureMode |= MSSPCloseGestureModeTapContent;
+    }
+    
+    if (gestureRecognizer == [self panGestureRecognizer])
+    {
+        if ([self isTouch:touch inNavigationBars:navigationBarList])
+        {
+            closeGestureMode |= MSSPCloseGestureModePanNavBar;
+            [self setPanTouchLocation:MSSPPanTouchLocationNavBar];
+        }
+        else
+        {
+            closeGestureMode |= MSSPCloseGestureModePanContent;
+            [self setPanTouchLocation:MSSPPanTouchLocationContent];
+        }
+    }
+    
+    return (closeGestureMode);
+}
+
+/**
+ *  Verify if the touch is within the content of the center view, as it is displayed by the reveal style.
+ *
+ *  @param touch The touch
+ *
+ *  @return Return YES if the touch is whthin, else return NO.
+ */
+- (BOOL)isTouchInCenterView:(UITouch *)touch
+{
+    CGPoint touchPoint;
+    
+    touchPoint = [[self centerView] contentPointWithPoint:[touch locationInView:[self centerView]]];
+    
+    return (CGRectContainsPoint([[self centerView] bounds], touchPoint));
+}
+
+/**
+ *  Verify if the touch is within an navigation bar.
+ *
+ *  @param touch              The touch.
+ *  @param navigationBarsList The list of the navigation bar.
+ *
+ *  @return Return YES if the touch is within, else return NO.
+ */
+- (BOOL)isTouch:(UITouch *)touch inNavigationBars:(NSArray *)navigationBarsList
+{
+    UINavigationBar *navigationBar;
+    CGRect          navigationBarFrame;
+    CGPoint         touchPoint;
+    
+    touchPoint = [[self centerView] contentPointWithPoint:[touch locationInView:[self centerView]]];
+    for (navigationBar in navigationBarsList)
+    {
+        navigationBarFrame = [navigationBar convertRect:[navigationBar bounds] toView:[self centerView]];
+
+        if (CGRectContainsPoint(navigationBarFrame, touchPoint))
+            return (YES);
+    }
+    
+    return (NO);
+}
+
+/**
+ *  Return the list of the possible opening gestures recognized.
+ *
+ *  @param gestureRecognizer The gesture recognizer.
+ *  @param touch             The touch.
+ *
+ *  @return The opening gestures possibly recognized.
+ */
+- (MSSPOpenGestureMode)openGestureModeWithGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer andTouch:(UITouch *)touch
+{
+    MSSPOpenGestureMode     openGestureMode;
+    NSMutableArray          *navigationBarList;
+    
+    if (![self isTouchInCenterView:touch])
+        return (MSSPOpenGestureModeNone);
+    
+    openGestureMode = MSSPOpenGestureModeNone;
+    navigationBarList = [[NSMutableArray alloc] init];
+    [self fillNavigationBarsList:navigationBarList withSubviewsOfView:[self centerView]];
+    
+    if (gestureRecognizer == [self panGestureRecognizer])
+    {
+        if ([self isTouch:touch inNavigationBars:navigationBarList])
+        {
+            openGestureMode |= MSSPOpenGestureModePanNavBar;
+            [self setPanTouchLocation:MSSPPanTouchLocationNavBar];
+        }
+        else
+        {
+            openGestureMode |= MSSPOpenGestureModePanContent;
+            [self setPanTouchLocation:MSSPPanTouchLocationContent];
+        }
+    }
+    
+    return (openGestureMode);
+}
+
+/**
+ *  Called when a panning is recognized.
+ *
+ *  @param panGestureRecognizer The gesture recognizer.
+ */
+- (void)panGestureRecognized:(UIPanGestureRecognizer *)panGestureRecognizer
+{
+    MSSPPanelEngine engine;
+    CGRect          newCenterViewFrame;
+    CGPoint         translation;
+    CGFloat         translationX;
+    
+    if ([panGestureRecognizer state] == UIGestureRecognizerStateBegan)
+    {
+        [self fillPanelEngine:&engine];
+        MSSPPanTrackerBegin(&_panTracker, &engine, (uintptr_t)(__bridge void *)[[self view] window], [[self centerView] frame].origin.x, [self panelEngineDirection]);
+        [self setPanHysteresisTranslation:0];
+        [self setPanOverscrollTranslation:0];
+        [self setPanDirectionLocked:NO];
+        [self setPanHandoffFollowing:([self handoffScrollView] != nil)];
+        
+        if (![self panDirectionLockEnabled] && ![self panHandoffFollowing])
+            [self beginPanSlide];
+    }
+    
+    if (!_panTracker.tracking)
+        return ;
+    
+    if (!MSSPPanTrackerIsInWindow(&_panTracker, (uintptr_t)(__bridge void *)[[self view] window]))
+    {
+        if ([self panSliding])
+            [self settlePanWithEnding:MSSPPanEndingCancelled];
+        else
+            [self abandonPan];
+        
+        [panGestureRecognizer setEnabled:NO];
+        [panGestureRecognizer setEnabled:YES];
+        
+        return ;
+    }
+    
+    if (([panGestureRecognizer state] == UIGestureRecognizerStateBegan || [panGestureRecognizer state] == UIGestureRecognizerStateChanged) && ![self panHandoffFollowing])
+        [self hintRevealWithPanVelocity:[panGestureRecognizer velocityInView:[self view]]];
+    
+    if ([self panDirectionLockEnabled] && ![self panDirectionLocked])
+    {
+        translation = [panGestureRecognizer translationInView:[self view]];
+        
+        if ([panGestureRecognizer state] != UIGestureRecognizerStateBegan && [panGestureRecognizer state] != UIGestureRecognizerStateChanged)
+            [self abandonPan];
+        else if (fabs(translation.x) >= [self panDirectionLockDistance])
+        {
+            [self setPanDirectionLocked:YES];
+            MSSPPanTrackerRebase(&_panTracker, translation.x);
+            
+            if (![self panHandoffFollowing])
+                [self beginPanSlide];
+        }
+        
+        return ;
+    }
+    
+    if ([self panHandoffFollowing])
+    {
+        translation = [panGestureRecognizer translationInView:[self view]];
+        
+        if ([panGestureRecognizer state] != UIGestureRecognizerStateBegan && [panGestureRecognizer state] != UIGestureRecognizerStateChanged)
+        {
+            [self abandonPan];
+            
+            return ;
+        }
+        
+        if (![self takeOverPanFromHandoffScrollViewWithTranslation:translation.x])
+        {
+            MSSPPanTrackerRebase(&_panTracker, translation.x);
+            
+            return ;
+        }
+    }
+    
+    translationX = MSSPPanTrackerMove(&_panTracker, [panGestureRecognizer translationInView:[self view]].x);
+    
+    newCenterViewFrame = [[self centerView] frame];
+    newCenterViewFrame.origin.x += translationX + [self panHysteresisTranslation] + [self panOverscrollTranslation];
+    [self setPanHysteresisTranslation:0];
+    [self setPanOverscrollTranslation:0];
+    [self slideCenterViewToFrame:newCenterViewFrame];
+    
+    // A failed recognizer never calls its action: the touch it owned is released by `gestureRecognizer:shouldReceiveTouch:`.
+    if ([panGestureRecognizer state] == UIGestureRecognizerStateEnded)
+        [self settlePanWithEnding:MSSPPanEndingCompleted];
+    else if ([panGestureRecognizer state] == UIGestureRecognizerStateCancelled)
+        [self settlePanWithEnding:MSSPPanEndingCancelled];
+}
+
+/**
+ *  Verify if the new frame is authorized to have these values.
+ *
+ *  @param newCenterViewFrame The new center view frame.
+ */
+- (void)panGestureVerifyAuthorizationForNewCenterViewFrame:(CGRect *)newCenterViewFrame
+{
+    MSSPPanelClamp  clamp;
+    MSSPPanelEngine engine;
+    
+    [self fillPanelEngine:&engine];
+    MSSPPanelEngineClamp(&engine, newCenterViewFrame->origin.x, [self panelEngineDirection], &clamp);
+    
+    [self setPanOverscrollTranslation:clamp.overscrollTranslation];
+    [self setPanHysteresisTranslation:clamp.hysteresisTranslation];
+    newCenterViewFrame->origin.x = clamp.originX;
+    
+    if ([self panRubberBandEnabled])
+        [self stretchDisplayedPanelToCenterViewOriginX:newCenterViewFrame->origin.x];
+    
+    if ([[self centerView] frame].origin.x <= 0 && newCenterViewFrame->origin.x > 0)
+    {   
+        if ([self sideDisplayed] != MSSPSideDisplayedNone)
+            [self notifyDelegateHasClosedSide:[self sideDisplayed]];
+        
+        if ([self interactiveRevealSide] != MSSPSideDisplayedLeft && !([self leftPanelOpenGestureMode] & [self panTouchLocation]))
+            newCenterViewFrame->origin.x = 0;
+        else
+        {
+            [self loadLeftPanel];
+            [self notifyDelegateBeginsToBringOutSide:[self sideDisplayed]];
+        }
+    }
+    else if ([[self centerView] frame].origin.x >= 0 && newCenterViewFrame->origin.x < 0)
+    {
+        if ([self sideDisplayed] != MSSPSideDisplayedNone)
+            [self notifyDelegateHasClosedSide:[self sideDisplayed]];
+        
+        if ([self interactiveRevealSide] != MSSPSideDisplayedRight && !([self rightPanelOpenGestureMode] & [self panTouchLocation]))
+            newCenterViewFrame->origin.x = 0;
+        else
+        {
+            [self loadRightPanel];
+            [self notifyDelegateBeginsToBringOutSide:[self sideDisplayed]];
+        }
+    }
+}
+
+/**
+ *  Set the gesture recognizers.
+ */
+- (void)setGestureRecognizers
+{
+    if (![self panGestureRecognizer])
+    {
+        [self setPanGestureRecognizer:[[UIPanGestureRecognizer alloc] initWithTarget:self action:@selector(panGestureRecognized:)]];
+        [[self panGestureRecognizer] setDelegate:self];
+        [[self panGestureRecognizer] setMinimumNumberOfTouches:1];
+        [[self panGestureRecognizer] setMaximumNumberOfTouches:1];
+    }
+    
+    if (![self tapGestureRecognizer])
+    {
+        [self setTapGestureRecognizer:[[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(tapGestureRecognized:)]];
+        [[self tapGestureRecognizer] setDelegate:self];
+        [[self tapGestureRecognizer] setNumberOfTapsRequired:1];
+        [[self tapGestureRecognizer] setNumberOfTouchesRequired:1];
+    }
+    
+    [[self view] addGestureRecognizer:[self panGestureRecognizer]];
+    [[self view] addGestureRecognizer:[self tapGestureRecognizer]];
+}
+
+/**
+ *  Move the center view during an interactive slide: the frame is clamped, the panels are loaded and the delegate is told, then the status bar and the effects follow the new position.
+ *
+ *  @param newCenterViewFrame The new center view frame.
+ */
+- (void)slideCenterViewToFrame:(CGRect)newCenterViewFrame
+{
+    [self panGestureVerifyAuthorizationForNewCenterViewFrame:&newCenterViewFrame];
+    [self adjustStatusBarColor];
+    [[self centerView] setFrame:newCenterViewFrame];
+    [self setCenterViewEffectsFraction:[self percentageVisibleOfDisplayedPanel] withDuration:0];
+    [self applyRevealStyle];
+}
+
+/**
+ *  End the current panning and move the center view to a stable position.
+ *
+ *  @param ending The way the panning ends.
+ */
+- (void)settlePanWithEnding:(MSSPPanEnding)ending
+{
+    MSSPPanelEngine engine;
+    int             side;
+    
+    if (!_panTracker.tracking)
+        return ;
+    
+    [self setRevealHintSides:0];
+    [self setHandoffScrollView:nil];
+    [self setPanHandoffFollowing:NO];
+    [self setPanHysteresisTranslation:0];
+    [self setPanOverscrollTranslation:0];
+    
+    [self fillPanelEngine:&engine];
+    side = MSSPPanTrackerEnd(&_panTracker, &engine, [[self centerView] frame].origin.x, [self panelEngineDirection], ending);
+    [self setPanOwnerTouch:nil];
+    [self setPanSliding:NO];
+    [self setNextSlideType:MSSPTransitionTypeSettle];
+    
+    if (side > 0)
+        [self openLeftPanel];
+    else if (side < 0)
+        [self openRightPanel];
+    else
+        [self closePanel];
+    
+    [self endSlide];
+}
+
+/**
+ *  Begin the slide of the current panning, which then moves the center view.
+ */
+- (void)beginPanSlide
+{
+    [self setPanSliding:YES];
+    [self setNextSlideType:MSSPTransitionTypeInteractive];
+    [self beginSlide];
+}
+
+/**
+ *  Forget the current panning before it moves the center view. Nothing has been begun, so nothing is torn down.
+ */
+- (void)abandonPan
+{
+    [self setRevealHintSides:0];
+    [self setHandoffScrollView:nil];
+    [self setPanHandoffFollowing:NO];
+    [self setPanOwnerTouch:nil];
+    MSSPPanTrackerInit(&_panTracker);
+}
+
+#pragma mark Scroll view handoff
+/** @name Scroll view handoff */
+
+/**
+ *  Indicate if a scroll view can still scroll in the direction of a panning translation.
+ *
+ *  @param scrollView   The scroll view.
+ *  @param translationX The horizontal panning translation.
+ *
+ *  @return YES if the scroll view is not at its content edge in this direction, else NO.
+ */
+- (BOOL)canScrollView:(UIScrollView *)scrollView scrollForTranslation:(CGFloat)translationX
+{
+    CGFloat offsetX;
+    
+    offsetX = [scrollView contentOffset].x;
+    
+    if (translationX > 0)
+        return (offsetX > - [scrollView contentInset].left);
+    else if (translationX < 0)
+        return (offsetX < [scrollView contentSize].width + [scrollView contentInset].right - [scrollView bounds].size.width);
+    
+    return (NO);
+}
+
+/**
+ *  Return the scroll view which can own a panning, under a touch.
+ *
+ *  @param touch The touch.
+ *
+ *  @return The nearest horizontal scroll view containing the touch, or `nil` if there is none or if the handoff is disabled.
+ */
+- (UIScrollView *)handoffScrollViewForTouch:(UITouch *)touch
+{
+    UIView  *view;
+    
+    if (![self scrollViewHandoffEnabled])
+        return (nil);
+    
+    for (view = [touch view]; view && view != [self view]; view = [view superview])
+    {
+        if ([view isKindOfClass:[UIScrollView class]] && [self isHandoffCandidateScrollView:(UIScrollView *)view])
+            return ((UIScrollView *)view);
+    }
+    
+    return (nil);
+}
+
+/**
+ *  Indicate if a scroll view can own the panning instead of the center view.
+ *
+ *  @param scrollView The scroll view.
+ *
+ *  @return YES if the scroll view scrolls horizontally and belongs to the center view or a panel, else NO.
+ */
+- (BOOL)isHandoffCandidateScrollView:(UIScrollView *)scrollView
+{
+    if (![scrollView isScrollEnabled] || [scrollView contentSize].width + [scrollView contentInset].left + [scrollView contentInset].right <= [scrollView bounds].size.width)
+        return (NO);
+    
+    return ([scrollView isDescendantOfView:[self view]]);
+}
+
+/**
+ *  Give the current panning to the center view if the handoff scroll view has reached its content edge in the panning direction.
+ *  The scroll view is then stopped at its edge, and the part of the translation which went beyond the edge moves the center view.
+ *
+ *  @param translationX The horizontal translation of the panning since its beginning.
+ *
+ *  @return YES if the center view owns the panning, else NO.
+ */
+- (BOOL)takeOverPanFromHandoffScrollViewWithTranslation:(CGFloat)translationX
+{
+    CGFloat         boundX;
+    CGFloat         directionX;
+    UIScrollView    *scrollView;
+    
+    scrollView = [self handoffScrollView];
+    directionX = translationX - _panTracker.translationX;
+    
+    if (scrollView && (directionX == 0 || [self canScrollView:scrollView scrollForTranslation:directionX]))
+        return (NO);
+    
+    if (scrollView)
+    {
+        if (directionX > 0)
+            boundX = - [scrollView contentInset].left;
+        else
+            boundX = [scrollView contentSize].width + [scrollView contentInset].right - [scrollView bounds].size.width;
+        
+        // The translation which has bounced the content beyond its edge is given to the center view.
+        MSSPPanTrackerRebase(&_panTracker, translationX - (boundX - [scrollView contentOffset].x));
+        
+        [[scrollView panGestureRecognizer] setEnabled:NO];
+        [[scrollView panGestureRecognizer] setEnabled:YES];
+        [scrollView setContentOffset:CGPointMake(boundX, [scrollView contentOffset].y)];
+    }
+    
+    [self setPanHandoffFollowing:NO];
+    [self beginPanSlide];
+    
+    return (YES);
+}
+
+#pragma mark Reveal hints
+/** @name Reveal hints */
+
+/**
+ *  Tell the delegate that a side will probably be brought out, if it has not already been told during the current gesture.
+ *
+ *  @param side         The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param timeInterval The estimated time before the panel is entirely visible.
+ */
+- (void)hintRevealOfSide:(MSSPSideDisplayed)side inTimeInterval:(NSTimeInterval)timeInterval
+{
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (([self revealHintSides] & MSSPSideMask(side)) || [self sideDisplayed] == side)
+        return ;
+    
+    [self setRevealHintSides:[self revealHintSides] | MSSPSideMask(side)];
+    [self notifyDelegateWillProbablyBringOutSide:side inTimeInterval:timeInterval];
+}
+
+/**
+ *  Tell the delegate which side will probably be brought out in function of the panning velocity.
+ *
+ *  @param velocity The panning velocity.
+ */
+- (void)hintRevealWithPanVelocity:(CGPoint)velocity
+{
+    CGFloat             distance;
+    MSSPSideDisplayed   side;
+    
+    if (fabs(velocity.x) < g_revealHintMinimumVelocity || fabs(velocity.x) <= fabs(velocity.y))
+        return ;
+    
+    side = (velocity.x > 0 ? MSSPSideDisplayedLeft : MSSPSideDisplayedRight);
+    
+    if (![self isRevealOfSideAllowedByPanning:side])
+        return ;
+    
+    if (side == MSSPSideDisplayedLeft)
+        distance = [self leftPanelMaximumWidth] - [[self centerView] frame].origin.x;
+    else
+        distance = [self rightPanelMaximumWidth] + [[self centerView] frame].origin.x;
+    
+    [self hintRevealOfSide:side inTimeInterval:distance / fabs(velocity.x)];
+}
+
+/**
+ *  Tell the delegate which side will probably be brought out in function of the location of a touch which begins.
+ *
+ *  @param touch The touch.
+ */
+- (void)hintRevealWithTouch:(UITouch *)touch
+{
+    MSSPSideDisplayed   side;
+    CGPoint             touchPoint;
+    
+    if ([self sideDisplayed] != MSSPSideDisplayedNone || [self revealHintEdgeWidth] <= 0)
+        return ;
+    
+    touchPoint = [touch locationInView:[self view]];
+    
+    if (touchPoint.x <= [self revealHintEdgeWidth])
+        side = MSSPSideDisplayedLeft;
+    else if (touchPoint.x >= [[self view] bounds].size.width - [self revealHintEdgeWidth])
+        side = MSSPSideDisplayedRight;
+    else
+        return ;
+    
+    if (![self isRevealOfSideAllowedByPanning:side])
+        return ;
+    
+    [self hintRevealOfSide:side inTimeInterval:[self animationDurationForLength:[self panelMaximumWithForSide:side]]];
+}
+
+/**
+ *  Indicate if a side can be brought out by the current panning.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *
+ *  @return YES if the side can be brought out, else NO.
+ */
+- (BOOL)isRevealOfSideAllowedByPanning:(MSSPSideDisplayed)side
+{
+    MSSPOpenGestureMode openGestureMode;
+    
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (![self panelControllerForSide:side])
+        return (NO);
+    
+    if (side == MSSPSideDisplayedLeft)
+        openGestureMode = [self leftPanelOpenGestureMode];
+    else
+        openGestureMode = [self rightPanelOpenGestureMode];
+    
+    return ((openGestureMode & [self panTouchLocation]) > 0);
+}
+
+/**
+ *  Called when a tap is recognized.
+ *
+ *  @param tapGestureRecognizer The gesture recognizer.
+ */
+- (void)tapGestureRecognized:(UITapGestureRecognizer *)__unused tapGestureRecognizer
+{
+    [self closePanel];
+}
+
+#pragma mark Load and unload panels
+/** @name Load and unload panels */
+
+/**
+ *  Add the view of a panel to the view hierarchy, if it is not already there.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)installPanelViewForSide:(MSSPSideDisplayed)side
+{
+    UIViewController    *panelController;
+    
+    NSParameterAssert(side != MSSPSideDisplayedNone);
+    
+    if (!(panelController = [self panelControllerForSide:side]))
+        return ;
+    
+    if (side == MSSPSideDisplayedLeft)
+    {
+        [[panelController view] setFrame:CGRectMake(0, 0, [self leftPanelMaximumWidth], [[self view] bounds].size.height)];
+        [[panelController view] setAutoresizingMask:(UIViewAutoresizingFlexibleHeight | UIViewAutoresizingFlexibleRightMargin)];
+    }
+    else
+    {
+        [[panelController view] setFrame:CGRectMake([[self view] bounds].size.width - [self rightPanelMaximumWidth], 0, [self rightPanelMaximumWidth], [[self view] bounds].size.height)];
+        [[panelController view] setAutoresizingMask:(UIViewAutoresizingFlexibleHeight | UIViewAutoresizingFlexibleLeftMargin)];
+    }
+    
+    if ([[panelController view] superview] == [self view])
+        return ;
+    
+    if ([self keepsPanelsLoaded] && side != [self sideDisplayed])
+        [[panelController view] setHidden:YES];
+    
+    [[self view] addSubview:[panelController view]];
+    [[self view] sendSubviewToBack:[panelController view]];
+}
+
+/**
+ *  Load the left panel.
+ */
+- (void)loadLeftPanel
+{
+    [self loadPanelForSide:MSSPSideDisplayedLeft];
+}
+
+/**
+ *  Load the panel corresponding to the side.
+ *
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ */
+- (void)loadPanelForSide:(MSSPSideDisplayed)side
+{
+    if (side == MSSPSideDisplayedNone)
+        return ;
+    
+    if (![self panelControllerForSide:side] || [self sideDisplayed] == side)
+        return ;
+    
+    [self enterStallPhase:MSSPStallPhasePanelLoad];
+    
+    if ([self sideDisplayed] != MSSPSideDisplayedNone)
+        [self unloadPanelForSide:[self sideDisplayed]];
+    
+    [self setSideDisplayed:side];
+    [self installPanelViewForSide:side];
+    [[[self panelControllerForSide:side] view] setHidden:NO];
+    [self beginAppearanceTransitionOfPanelForSide:side appearing:YES animated:YES];
+    
+    if ([self keepsPanelsLoaded])
+        [self installPanelViewForSide:(side == MSSPSideDisplayedLeft ? MSSPSideDisplayedRight : MSSPSideDisplayedLeft)];
+    
+    [self exitStallPhase];
 }
 
-@end
-
-@implementation MSSlidingPanelController
+/**
+ *  Load the right panel.
+ */
+- (void)loadRightPanel
+{
+    [self loadPanelForSide:MSSPSideDisplayedRight];
+}
 
-#pragma mark Initialization
-/** @name Initialization */
+/**
+ *  Unload the left panel.
+ */
+- (void)unloadLeftPanel
+{
+    [self unloadPanelForSide:MSSPSideDisplayedLeft];
+}
 
 /**
- *  Initialize and return a new sliding panel controller.
+ *  Unload the panel corresponding to the side.
  *
- *  @return The intialized centrer view controller.
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
  */
-- (id)init
+- (void)unloadPanelForSide:(MSSPSideDisplayed)side
 {
-    self = [super init];
+    if (side == MSSPSideDisplayedNone)
+        return ;
     
-    if (self)
-        [self commonSettings];
+    if (![self panelControllerForSide:side] || [self sideDisplayed] != side)
+        return ;
     
-    return (self);
+    [self resetRevealStyleOfPanelView:[[self panelControllerForSide:side] view]];
+    [self beginAppearanceTransitionOfPanelForSide:side appearing:NO animated:YES];
+    
+    if ([self keepsPanelsLoaded])
+        [[[self panelControllerForSide:side] view] setHidden:YES];
+    else
+        [[[self panelControllerForSide:side] view] removeFromSuperview];
+    
+    [self endAppearanceTransitionOfPanelForSide:side];
+    [self setSideDisplayed:MSSPSideDisplayedNone];
 }
 
 /**
- *  Returns an object initialized from data in a given unarchiver.
- *
- *  @param aDecoder An unarchiver object.
- *
- *  @return self, initialized using the data in decoder.
+ *  Unload the right panel.
  */
-- (id)initWithCoder:(NSCoder *)aDecoder
+- (void)unloadRightPanel
 {
-    self = [super initWithCoder:aDecoder];
-    
-    if (self)
-        [self commonSettings];
-    
-    return (self);
+    [self unloadPanelForSide:MSSPSideDisplayedRight];
 }
 
+#pragma mark Appearance
+/** @name Appearance */
+
 /**
- *  Initialize and return a new sliding panel controller.
+ *  Return the appearance state of a panel.
  *
- *  @param nibNameOrNil   The nib name or nil.
- *  @param nibBundleOrNil The bundle name or nil.
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
  *
- *  @return The initialized centrer view controller.
+ *  @return The appearance state.
  */
-- (id)initWithNibName:(NSString *)nibNameOrNil bundle:(NSBundle *)nibBundleOrNil
+- (MSSPAppearanceState)appearanceStateOfPanelForSide:(MSSPSideDisplayed)side
 {
-    self = [super initWithNibName:nibNameOrNil bundle:nibBundleOrNil];
-    
-    if (self)
-        [self commonSettings];
+    NSParameterAssert(side != MSSPSideDisplayedNone);
     
-    return (self);
+    if (side == MSSPSideDisplayedLeft)
+        return ([self leftPanelAppearanceState]);
+    else
+        return ([self rightPanelAppearanceState]);
 }
 
 /**
- *  Initialize and return a new sliding panel controller.
- *
- *  @param centerViewController The center view controller. Must not be `nil`.
+ *  Tell a panel that it begins to appear or to disappear, if it is not already doing so. A panel only appears while the view of the sliding panel controller is visible.
  *
- *  @return The initialized centrer view controller.
+ *  @param side      The side.
+ *  @param appearing `YES` if the panel begins to appear, `NO` if it begins to disappear.
+ *  @param animated  `YES` if the transition is animated, else `NO`.
  */
-- (id)initWithCenterViewController:(UIViewController *)centerViewController
+- (void)beginAppearanceTransitionOfPanelForSide:(MSSPSideDisplayed)side appearing:(BOOL)appearing animated:(BOOL)animated
 {
-    self = [super init];
+    MSSPAppearanceState appearanceState;
     
-    if (self)
+    if (side == MSSPSideDisplayedNone || ![self panelControllerForSide:side])
+        return ;
+    
+    appearanceState = [self appearanceStateOfPanelForSide:side];
+    
+    if (appearing && [self viewVisible] && (appearanceState == MSSPAppearanceStateDisappeared || appearanceState == MSSPAppearanceStateDisappearing))
     {
-        [self commonSettings];
-        [self setCenterViewController:centerViewController];
+        [[self panelControllerForSide:side] beginAppearanceTransition:YES animated:animated];
+        [self setAppearanceState:MSSPAppearanceStateAppearing ofPanelForSide:side];
+    }
+    else if (!appearing && (appearanceState == MSSPAppearanceStateAppearing || appearanceState == MSSPAppearanceStateAppeared))
+    {
+        [[self panelControllerForSide:side] beginAppearanceTransition:NO animated:animated];
+        [self setAppearanceState:MSSPAppearanceStateDisappearing ofPanelForSide:side];
     }
-    
-    return (self);
 }
 
 /**
- *  Initialize and return a new sliding panel controller.
- *
- *  @param centerViewController The center view controller. Must not be `nil`.
- *  @param leftPanelController  The left panel controller.
+ *  Tell a panel that its current appearance transition ends. Does nothing if no transition is running.
  *
- *  @return The initialized centrer view controller.
+ *  @param side The side.
  */
-- (id)initWithCenterViewController:(UIViewController *)centerViewController andLeftPanelController:(UIViewController *)leftPanelController
+- (void)endAppearanceTransitionOfPanelForSide:(MSSPSideDisplayed)side
 {
-    self = [super init];
+    MSSPAppearanceState appearanceState;
     
-    if (self)
+    if (side == MSSPSideDisplayedNone || ![self panelControllerForSide:side])
+        return ;
+    
+    appearanceState = [self appearanceStateOfPanelForSide:side];
+    
+    if (appearanceState == MSSPAppearanceStateAppearing)
     {
-        [self commonSettings];
-        [self setCenterViewController:centerViewController];
-        [self setLeftPanelController:leftPanelController];
+        [[self panelControllerForSide:side] endAppearanceTransition];
+        [self setAppearanceState:MSSPAppearanceStateAppeared ofPanelForSide:side];
+    }
+    else if (appearanceState == MSSPAppearanceStateDisappearing)
+    {
+        [[self panelControllerForSide:side] endAppearanceTransition];
+        [self setAppearanceState:MSSPAppearanceStateDisappeared ofPanelForSide:side];
     }
-    
-    return (self);
 }
 
 /**
- *  Initialize and return a new sliding panel controller.
+ *  Return if a panel is hidden: it has received `viewDidDisappear:` or has never appeared. A hidden panel should pause its timers, queries and animations.
  *
- *  @param centerViewController The center view controller. Must not be `nil`.
- *  @param rightPanelController The right panel controller.
+ *  @param side The side. Must not be `MSSPSideDisplayedNone`.
  *
- *  @return The initialized centrer view controller.
+ *  @return YES if the panel is hidden or if there is no panel on this side, else NO.
  */
-- (id)initWithCenterViewController:(UIViewController *)centerViewController andRightPanelController:(UIViewController *)rightPanelController
+- (BOOL)isPanelHiddenForSide:(MSSPSideDisplayed)side
 {
-    self = [super init];
-    
-    if (self)
-    {
-        [self commonSettings];
-        [self setCenterViewController:centerViewController];
-        [self setRightPanelController:rightPanelController];
-    }
+    NSParameterAssert(side != MSSPSideDisplayedNone);
     
-    return (self);
+    return (![self panelControllerForSide:side] || [self appearanceStateOfPanelForSide:side] == MSSPAppearanceStateDisappeared);
 }
 
 /**
- *  Initialize and return a new sliding panel controller.
- *
- *  @param centerViewController The center view controller. Must not be `nil`.
- *  @param leftPanelController  The left panel controller.
- *  @param rightPanelController The right panel controller.
+ *  Set the appearance state of a panel.
  *
- *  @return The initialized centrer view controller.
+ *  @param appearanceState The appearance state.
+ *  @param side            The side. Must not be `MSSPSideDisplayedNone`.
  */
-- (id)initWithCenterViewController:(UIViewController *)centerViewController leftPanelController:(UIViewController *)leftPanelController andRightPanelController:(UIViewController *)rightPanelController
+- (void)setAppearanceState:(MSSPAppearanceState)appearanceState ofPanelForSide:(MSSPSideDisplayed)side
 {
-    self = [super init];
-    
-    if (self)
-    {
-        [self commonSettings];
-        [self setCenterViewController:centerViewController];
-        [self setLeftPanelController:leftPanelController];
-        [self setRightPanelController:rightPanelController];
-    }
+    NSParameterAssert(side != MSSPSideDisplayedNone);
     
-    return (self);
+    if (side == MSSPSideDisplayedLeft)
+        [self setLeftPanelAppearanceState:appearanceState];
+    else
+        [self setRightPanelAppearanceState:appearanceState];
 }
 
-#pragma mark View life cycle
-/** @name View life cycle */
-
 /**
- *  Creates the view that the controller manages.
+ *  Indicate if the appearance methods are forwarded automatically to the child view controllers. The sliding panel controller forwards them itself, only to the center view controller and the displayed panel.
+ *
+ *  @return NO.
  */
-- (void)loadView
+- (BOOL)shouldAutomaticallyForwardAppearanceMethods
 {
-    CGSize  windowSize;
-    
-    [super loadView];
-    
-    windowSize = [[UIScreen mainScreen] bounds].size;
-    
-    if ([self storyboard])
-        [self setViewsFromStoryboard];
-    
-    [self setStatusBarView:[[UIView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, 20)]];
-    [[self statusBarView] setBackgroundColor:[self centerViewStatusBarColor]];
-    [[self statusBarView] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth)];
-    [[self statusBarView] setUserInteractionEnabled:NO];
-    
-    [self setCenterView:[[MSSlidingPanelCenterView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, windowSize.height)]];
-    [[self centerView] setSlidingPanelController:self];
-    [[[self centerViewController] view] setFrame:[[self centerView] frame]];
-    [[[self centerViewController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
-    [[self centerView] addSubview:[[self centerViewController] view]];
-    [[self centerView] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
-    
-    [self setView:[[UIView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, windowSize.height)]];
-    [[self view] addSubview:[self centerView]];
-    [[self view] addSubview:[self statusBarView]];
-    [[self view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
-    
-    [self setGestureRecognizers];
+    return (NO);
 }
 
-#pragma mark Tools
-/** @name Tools */
+#pragma mark Actions
+/** @name Actions */
 
 /**
- *  Adjust the status bar color.
+ *  Animate the center view to a horizontal position, following the animation curve.
+ *
+ *  @param originX    The horizontal position of the center view at the end of the animation.
+ *  @param duration   The duration of the animation.
+ *  @param animations A block object containing the other changes to animate. May be `nil`.
+ *  @param completion A block object to be executed when the animation ends.
  */
-- (void)adjustStatusBarColor
+- (void)animateCenterViewToOriginX:(CGFloat)originX withDuration:(NSTimeInterval)duration animations:(void (^)(void))animations completion:(void (^)(BOOL finished))completion
 {
-    UIColor *statusBarColor;
-    CGFloat percentVisible;
-    CGFloat statusBarCenterAlpha;
-    CGFloat statusBarCenterBlue;
-    CGFloat statusBarCenterGreen;
-    CGFloat statusBarCenterRed;
-    CGFloat statusBarPanelAlpha;
-    CGFloat statusBarPanelBlue;
-    CGFloat statusBarPanelGreen;
-    CGFloat statusBarPanelRed;
+    CAKeyframeAnimation *animation;
+    CGFloat             fromOriginX;
+    CGRect              frame;
+    NSUInteger          i;
+    CGPoint             position;
+    NSMutableArray      *values;
     
-    statusBarColor = [self statusBarColorForSide:[self sideDisplayed]];
+    frame = [[self centerView] frame];
+    fromOriginX = frame.origin.x;
+    frame.origin.x = originX;
+    frame.origin.y = 0;
     
-    if ([self sideDisplayed] != MSSPSideDisplayedNone && [self statusBarDisplayedSmoothlyForSide:[self sideDisplayed]])
+    [self addRevealStyleAnimationsToOriginX:originX withDuration:duration];
+    
+    if (duration <= 0)
     {
-        if (![[self centerViewStatusBarColor] getRed:&statusBarCenterRed green:&statusBarCenterGreen blue:&statusBarCenterBlue alpha:&statusBarCenterAlpha])
-        {
-            [[self centerViewStatusBarColor] getWhite:&statusBarCenterRed alpha:&statusBarCenterAlpha];
-            
-            statusBarCenterGreen = statusBarCenterRed;
-            statusBarCenterBlue = statusBarCenterRed;
-        }
-        
-        if (![statusBarColor getRed:&statusBarPanelRed green:&statusBarPanelGreen blue:&statusBarPanelBlue alpha:&statusBarPanelAlpha])
-        {
-            [statusBarColor getWhite:&statusBarPanelRed alpha:&statusBarPanelAlpha];
-            
-            statusBarPanelGreen = statusBarPanelRed;
-            statusBarPanelBlue = statusBarPanelRed;
-        }
+        if (animations)
+            animations();
         
-        percentVisible = [self percentageVisibleOfDisplayedPanel];
+        [[self centerView] setFrame:frame];
         
-        statusBarCenterRed += (statusBarPanelRed - statusBarCenterRed) * percentVisible;
-        statusBarCenterGreen += (statusBarPanelGreen - statusBarCenterGreen) * percentVisible;
-        statusBarCenterBlue += (statusBarPanelBlue - statusBarCenterBlue) * percentVisible;
-        statusBarCenterAlpha += (statusBarPanelAlpha - statusBarCenterAlpha) * percentVisible;
+        if (completion)
+            completion(YES);
         
-        [[self statusBarView] setBackgroundColor:[UIColor colorWithRed:statusBarCenterRed green:statusBarCenterGreen blue:statusBarCenterBlue alpha:statusBarCenterAlpha]];
+        return ;
     }
-    else
-        [[self statusBarView] setBackgroundColor:statusBarColor];
-}
-
-/**
- *  Returns the animation duration for a given length.
- *
- *  @param length The length.
- *
- *  @return The duration.
- */
-- (NSTimeInterval)animationDurationForLength:(CGFloat)length
-{
-    if (length <= 0)
-        length *= -1;
     
-    return (length / [self animationVelocity]);
+    if (animations)
+        [UIView animateWithDuration:duration delay:0 options:UIViewAnimationOptionCurveLinear animations:animations completion:nil];
+    
+    [[self centerView] setFrame:frame];
+    position = [[[self centerView] layer] position];
+    
+    values = [[NSMutableArray alloc] initWithCapacity:g_animationKeyframesCount + 1];
+    for (i = 0; i <= g_animationKeyframesCount; i++)
+        [values addObject:[NSValue valueWithCGPoint:CGPointMake(position.x - originX + MSSPPanelEngineAnimationOriginX([self animationCurve], fromOriginX, originX, (double)i / g_animationKeyframesCount), position.y)]];
+    
+    // An explicit animation, unlike the UIView ones, can request the frame rate range of the slide.
+    animation = [CAKeyframeAnimation animationWithKeyPath:@"position"];
+    [animation setValues:values];
+    [animation setDuration:duration];
+    [animation setDelegate:self];
+    
+    if (completion)
+        [animation setValue:[completion copy] forKey:MSSPAnimationKeyCompletion];
+    
+    [self applyFrameRateRangeToAnimation:animation];
+    [[[self centerView] layer] addAnimation:animation forKey:@"position"];
 }
 
 /**
- *  Set initial values to variables.
+ *  Tells the delegate the animation has ended. Execute the completion block of the animations of the center view.
+ *
+ *  @param animation The CAAnimation object that has ended.
+ *  @param finished  YES if the animation has completed its full duration, NO if it was removed before.
  */
-- (void)commonSettings
+- (void)animationDidStop:(CAAnimation *)animation finished:(BOOL)finished
 {
-    _centerViewController = nil;
-    [self setCenterViewStatusBarColor:[UIColor clearColor]];
-    
-    [self setLeftPanelCenterViewInteractionMode:MSSPCenterViewInteractionNavBar];
-    [self setLeftPanelCloseGestureMode:MSSPCloseGestureModeAll];
-    [self setLeftPanelController:nil];
-    [self setLeftPanelMaximumWidth:g_panelMaximumWidth];
-    [self setLeftPanelOpenGestureMode:MSSPOpenGestureModeAll];
-    [self setLeftPanelStatusBarColor:[UIColor clearColor]];
-    [self setLeftPanelStatusBarDisplayedSmoothly:NO];
+    void    (^completion)(BOOL);
     
-    [self setRightPanelCenterViewInteractionMode:MSSPCenterViewInteractionNavBar];
-    [self setRightPanelCloseGestureMode:MSSPCloseGestureModeAll];
-    [self setRightPanelController:nil];
-    [self setRightPanelMaximumWidth:g_panelMaximumWidth];
-    [self setRightPanelOpenGestureMode:MSSPOpenGestureModeAll];
-    [self setRightPanelStatusBarColor:[UIColor clearColor]];
-    [self setRightPanelStatusBarDisplayedSmoothly:NO];
- 
-    [self setAnimationVelocity:g_animationVelocity];
-    [self setSideDisplayed:MSSPSideDisplayedNone];
+    if ((completion = [animation valueForKey:MSSPAnimationKeyCompletion]))
+        completion(finished);
 }
 
 /**
- *  Find every navigation bar in a view.
- *
- *  @param navigationBarList A array which contains the list of every navigation bar found. Must be initialized.
- *  @param view              The view.
+ *  Close the opened panel.
  */
-- (void)fillNavigationBarsList:(NSMutableArray *)navigationBarList withSubviewsOfView:(UIView *)view
+- (void)closePanel
 {
-    UIView  *subview;
-    
-    if ([view isKindOfClass:[UINavigationBar class]])
-        [navigationBarList addObject:view];
-    
-    for (subview in [view subviews])
-        [self fillNavigationBarsList:navigationBarList withSubviewsOfView:subview];
+    [self closePanelWithCompletion:nil];
 }
 
 /**
- *  The percentage visible of the current panel displayed.
+ *  Close the opened panel.
  *
- *  @return The percentage.
+ *  @param completion A block object to be executed when the panel is closed.
  */
-- (CGFloat)percentageVisibleOfDisplayedPanel
+- (void)closePanelWithCompletion:(void (^)(void))completion
 {
-    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
-        return ([[self centerView] frame].origin.x / [self leftPanelMaximumWidth]);
-    else if ([self sideDisplayed] == MSSPSideDisplayedRight)
-        return ([[self centerView] frame].origin.x / - (NSInteger)[self rightPanelMaximumWidth]);
-    
-    return (0);
+    [self enqueueTransitionToSide:MSSPSideDisplayedNone animated:YES withCompletion:[self transitionCompletionWithActionCompletion:completion toSide:MSSPSideDisplayedNone]];
 }
 
-#pragma mark Set center view and panels
-/** @name Set center view and panels */
-
 /**
- *  Set the center view controller value.
+ *  Animate the closing of the opened panel.
  *
- *  @param centerViewController The center view controller. Must not be nil.
+ *  @param completion A block object to be executed when the animation ends, even if no panel was opened. Its parameter is NO if the animation has been interrupted.
  */
-- (void)setCenterViewController:(UIViewController *)centerViewController
+- (void)animateClosePanelWithCompletion:(void (^)(BOOL finished))completion
 {
-    CGRect  frame;
-    
-    NSParameterAssert(centerViewController);
+    void    (^animationBlock)(void);
+    CGFloat animationLength;
+    void    (^completionBlock)(BOOL);
     
-    if ([self isViewLoaded])
-#ifndef __clang_analyzer__
-        frame = [[[self centerViewController] view] frame];
-#endif
+    if (![self centerViewController] || [self sideDisplayed] == MSSPSideDisplayedNone)
+    {
+        if (completion)
+            completion(YES);
+        
+        return ;
+    }
     
-    [[[self centerViewController] view] removeFromSuperview];
-    [[self centerViewController] removeFromParentViewController];
+    animationBlock = ^()
+    {
+        if ([self statusBarDisplayedSmoothlyForSide:[self sideDisplayed]])
+            [[self statusBarView] setBackgroundColor:[self statusBarColorForSide:MSSPSideDisplayedNone]];
+    };
     
-    _centerViewController = centerViewController;
+    completionBlock = ^(BOOL finished)
+    {
+        if (finished)
+        {
+            [self notifyDelegateHasClosedSide:[self sideDisplayed]];
+            [self unloadPanelForSide:[self sideDisplayed]];
+            [self adjustStatusBarColor];
+        }
+        
+        [self endSlide];
+        
+        if (completion)
+            completion(finished);
+    };
     
-    [self addChildViewController:[self centerViewController]];
-    [[self centerViewController] didMoveToParentViewController:self];
+    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
+        animationLength = [[self centerView] frame].origin.x;
+    else
+        animationLength = -[[self centerView] frame].origin.x;
     
-    if ([self isViewLoaded])
-    {
-#ifndef __clang_analyzer__
-        [[[self centerViewController] view] setFrame:frame];
-#endif
-        [[[self centerViewController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
-        [[self centerView] addSubview:[[self centerViewController] view]];
-    }
+    [self beginAppearanceTransitionOfPanelForSide:[self sideDisplayed] appearing:NO animated:YES];
+    [self beginSlide];
+    [self setCenterViewEffectsFraction:0 withDuration:[self animationDurationForLength:animationLength]];
+    [self animateCenterViewToOriginX:0 withDuration:[self animationDurationForLength:animationLength] animations:animationBlock completion:completionBlock];
 }
 
 /**
- *  Set the left panel controller value.
+ *  Open the left panel.
+ */
+- (void)openLeftPanel
+{
+    [self openLeftPanelWithCompletion:nil];
+}
+
+/**
+ *  Open the left panel.
  *
- *  @param leftPanelController The left panel controller.
+ *  @param completion A block object to be executed when the panel is opened.
  */
-- (void)setLeftPanelController:(UIViewController *)leftPanelController
+- (void)openLeftPanelWithCompletion:(void (^)(void))completion
 {
-    [self setPanelController:leftPanelController forSide:MSSPSideDisplayedLeft];
+    [self openPanelSide:MSSPSideDisplayedLeft withCompletion:completion];
 }
 
 /**
- *  Set a panel controller for a side.
+ *  Open the panel corresponding to the side.
  *
- *  @param panelController The panel controller.
- *  @param side            The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param side       The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param completion A block object to be executed when the panel is opened.
  */
-- (void)setPanelController:(UIViewController *)panelController forSide:(MSSPSideDisplayed)side
+- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion
 {
-    __block BOOL    reloadPanel;
-    void            (^setController)(void);
+    NSParameterAssert(side != MSSPSideDisplayedNone);
     
+    [self enqueueTransitionToSide:side animated:YES withCompletion:[self transitionCompletionWithActionCompletion:completion toSide:side]];
+}
+
+/**
+ *  Open the panel corresponding to the side.
+ *
+ *  @param side                 The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param completion           A block object to be executed when the animation ends. Its parameter is NO if the animation has been interrupted or if there is no panel on this side.
+ *  @param statusBarColorUpdate A value which indicate if the status bar color must be updated before the animation.
+ */
+- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(BOOL finished))completion andStatusBarColorUpdate:(BOOL)statusBarColorUpdate
+{
+    void                (^animationBlock)(void);
+    void                (^completionBlock)(BOOL);
+    void                (^openPanelBlock)();
+    UIViewController    *panelController;
+ 
     NSParameterAssert(side != MSSPSideDisplayedNone);
     
-    reloadPanel = NO;
-    setController = ^(void)
+    if (!(panelController = [self panelControllerForSide:side]))
     {
-        [[self panelControllerForSide:side] removeFromParentViewController];
-        
-        if (side == MSSPSideDisplayedLeft)
-            _leftPanelController = panelController;
-        else
-            _rightPanelController = panelController;
+        if (completion)
+            completion(NO);
         
-        if (!panelController)
-            return ;
+        return ;
+    }
+    
+    animationBlock = ^()
+    {
+        CGRect  frame;
         
-        [self addChildViewController:panelController];
-        [[self panelControllerForSide:side] didMoveToParentViewController:self];
+        if ([self statusBarDisplayedSmoothlyForSide:side])
+            [[self statusBarView] setBackgroundColor:[self statusBarColorForSide:side]];
         
-        if (reloadPanel)
-            [self loadPanelForSide:side];
+        if ([[panelController view] frame].size.width != [self panelMaximumWithForSide:side])
+        {
+            frame = [[panelController view] frame];
+            frame.size.width = [self panelMaximumWithForSide:side];
+            
+            if (side == MSSPSideDisplayedRight)
+                frame.origin.x = [[self centerView] frame].size.width - [self panelMaximumWithForSide:side];
+                
+            [[panelController view] setFrame:frame];
+        }
     };
     
-    if ([self isViewLoaded] && [self sideDisplayed] == side)
+    completionBlock = ^(BOOL finished)
     {
-        if (!panelController)
+        if (finished)
         {
-            [self closePanelWithCompletion:setController];
-            return ;
+            [self endAppearanceTransitionOfPanelForSide:side];
+            [self notifyDelegateHasOpenedSide:side];
         }
+        
+        [self endSlide];
+        
+        if (completion)
+            completion(finished);
+    };
+    
+    openPanelBlock = ^()
+    {
+        CGFloat animationLength;
+        CGFloat x;
+        
+        [self loadPanelForSide:side];
+        [self beginAppearanceTransitionOfPanelForSide:side appearing:YES animated:YES];
+        
+        if (statusBarColorUpdate)
+            [self adjustStatusBarColor];
+        
+        if ([[self centerView] frame].origin.x == 0)
+            [self notifyDelegateBeginsToBringOutSide:side];
+        
+        if (side == MSSPSideDisplayedLeft)
+            animationLength = [self leftPanelMaximumWidth] - [[self centerView] frame].origin.x;
         else
-        {
-            [self unloadPanelForSide:side];
-            reloadPanel = YES;
-        }
-    }
+            animationLength = [self rightPanelMaximumWidth] + [[self centerView] frame].origin.x;
+        
+        [self beginSlide];
+        if (side == MSSPSideDisplayedLeft)
+            x = [self panelMaximumWithForSide:side];
+        else
+            x = - (CGFloat)[self panelMaximumWithForSide:side];
+        
+        [self setCenterViewEffectsFraction:1 withDuration:[self animationDurationForLength:animationLength]];
+        [self animateCenterViewToOriginX:x withDuration:[self animationDurationForLength:animationLength] animations:animationBlock completion:completionBlock];
+    };
     
-    setController();
+    if ([self sideDisplayed] != MSSPSideDisplayedNone && [self sideDisplayed] != side)
+    {
+        [self animateClosePanelWithCompletion:^(BOOL __unused finished)
+         {
+             openPanelBlock();
+         }];
+    }
+    else
+        openPanelBlock();
 }
 
 /**
- *  Set the right panel controller value.
- *
- *  @param rightPanelController The right panel controller.
+ *  Open the right panel.
  */
-- (void)setRightPanelController:(UIViewController *)rightPanelController
+- (void)openRightPanel
 {
-    [self setPanelController:rightPanelController forSide:MSSPSideDisplayedRight];
+    [self openRightPanelWithCompletion:nil];
 }
 
-#pragma mark Panels settings
-/** @name Panels settings */
-
 /**
- *  Set the maximum width of the left panel.
+ *  Open the right panel.
  *
- *  @param leftPanelMaximumWidth Left panel's maximum width.
+ *  @param completion A block object to be executed when the panel is opened.
  */
-- (void)setLeftPanelMaximumWidth:(CGFloat)leftPanelMaximumWidth
+- (void)openRightPanelWithCompletion:(void (^)(void))completion
 {
-    [self setLeftPanelMaximumWidth:leftPanelMaximumWidth withCompletion:nil];
+    [self openPanelSide:MSSPSideDisplayedRight withCompletion:completion];
 }
 
 /**
- *  Set the maximum width of the left panel with.
+ *  Display a side.
  *
- *  @param maximumWidth Panel's maximum width.
- *  @param completion   A block object to be executed when the maximum width is set.
+ *  @param sideDisplayed The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated      `YES` to animate the change, else `NO`.
  */
-- (void)setLeftPanelMaximumWidth:(CGFloat)leftPanelMaximumWidth withCompletion:(void (^)(void))completion
+- (void)setSideDisplayed:(MSSPSideDisplayed)sideDisplayed animated:(BOOL)animated
 {
-    [self setPanelMaximumWidth:leftPanelMaximumWidth forSide:MSSPSideDisplayedLeft withCompletion:completion];
+    [self setSideDisplayed:sideDisplayed animated:animated completion:nil];
 }
 
 /**
- *  Set the maximum width of a panel.
+ *  Display a side, and tell how the request ended.
  *
- *  @param panelMaximumWidth Panel's maximum width.
- *  @param side              The side. Must not be `MSSPSideDisplayedNone`.
- *  @param completion        A block object to be executed when the maximum width is set.
+ *  @param sideDisplayed The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated      `YES` to animate the change, else `NO`.
+ *  @param completion    A block object to be executed when the request is done. May be `nil`.
  */
-- (void)setPanelMaximumWidth:(CGFloat)panelMaximumWidth forSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion
+- (void)setSideDisplayed:(MSSPSideDisplayed)sideDisplayed animated:(BOOL)animated completion:(void (^)(MSSPTransitionResult result))completion
 {
-    NSParameterAssert(side != MSSPSideDisplayedNone);
-    
-    if (panelMaximumWidth < 0)
-        panelMaximumWidth = 0;
-    
-    if (panelMaximumWidth > [[UIScreen mainScreen] bounds].size.width)
-        panelMaximumWidth = [[UIScreen mainScreen] bounds].size.width;
-    
-    if (side == MSSPSideDisplayedLeft)
-        _leftPanelMaximumWidth = panelMaximumWidth;
-    else
-        _rightPanelMaximumWidth = panelMaximumWidth;
+    if (!animated && ![self isViewLoaded])
+    {
+        [self setSideDisplayedAtLoad:sideDisplayed];
+        
+        if (completion)
+            completion(MSSPTransitionResultCompleted);
+        
+        return ;
+    }
     
-    if ([self sideDisplayed] == side)
-        [self openPanelSide:side withCompletion:completion andStatusBarColorUpdate:NO];
-    else if (completion)
-        completion();
-}
-
-/**
- *  Set the maximum width of the right panel.
- *
- *  @param rightPanelMaximumWidth Right panel's maximum width.
- */
-- (void)setRightPanelMaximumWidth:(CGFloat)rightPanelMaximumWidth
-{
-    [self setRightPanelMaximumWidth:rightPanelMaximumWidth withCompletion:nil];
+    [self enqueueTransitionToSide:sideDisplayed animated:animated withCompletion:completion];
 }
 
 /**
- *  Set the maximum width of the right panel with.
+ *  Lay out a side directly in its final position, without animation.
  *
- *  @param maximumWidth Panel's maximum width.
- *  @param completion   A block object to be executed when the maximum width is set.
+ *  @param side The side. `MSSPSideDisplayedNone` closes the opened panel.
  */
-- (void)setRightPanelMaximumWidth:(CGFloat)rightPanelMaximumWidth withCompletion:(void (^)(void))completion
+- (void)displaySideWithoutAnimation:(MSSPSideDisplayed)side
 {
-    [self setPanelMaximumWidth:rightPanelMaximumWidth forSide:MSSPSideDisplayedRight withCompletion:completion];
+    CGRect              frame;
+    MSSPSideDisplayed   previousSide;
+    
+    if (side != MSSPSideDisplayedNone && ![self panelControllerForSide:side])
+        side = MSSPSideDisplayedNone;
+    
+    previousSide = [self sideDisplayed];
+    
+    if (previousSide != MSSPSideDisplayedNone && previousSide != side)
+    {
+        [self notifyDelegateHasClosedSide:previousSide];
+        [self unloadPanelForSide:previousSide];
+    }
+    
+    [self loadPanelForSide:side];
+    
+    frame = [[self centerView] frame];
+    frame.origin.y = 0;
+    
+    if (side == MSSPSideDisplayedLeft)
+        frame.origin.x = [self leftPanelMaximumWidth];
+    else if (side == MSSPSideDisplayedRight)
+        frame.origin.x = - (CGFloat)[self rightPanelMaximumWidth];
+    else
+        frame.origin.x = 0;
+    
+    [[self centerView] setFrame:frame];
+    [self stretchDisplayedPanelToCenterViewOriginX:frame.origin.x];
+    [self adjustStatusBarColor];
+    [self setCenterViewEffectsFraction:(side != MSSPSideDisplayedNone ? 1 : 0) withDuration:0];
+    [self applyRevealStyle];
+    [self endAppearanceTransitionOfPanelForSide:side];
+    
+    if (side == MSSPSideDisplayedNone || side == previousSide)
+        return ;
+    
+    [self notifyDelegateBeginsToBringOutSide:side];
+    [self notifyDelegateHasOpenedSide:side];
 }
 
-#pragma mark Panels information
-/** @name Panels information */
+#pragma mark Interactive reveal
+/** @name Interactive reveal */
 
 /**
- *  Return the panel controller for a side.
- *
- *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *  Begin to reveal a panel from an external driver: a scroll view, a custom gesture recognizer, a keyboard shortcut...
  *
- *  @return The panel controller.
+ *  @param side The side to reveal. Must not be `MSSPSideDisplayedNone`.
  */
-- (UIViewController *)panelControllerForSide:(MSSPSideDisplayed)side
+- (void)beginInteractiveReveal:(MSSPSideDisplayed)side
 {
     NSParameterAssert(side != MSSPSideDisplayedNone);
     
-    if (side == MSSPSideDisplayedLeft)
-        return ([self leftPanelController]);
-    else
-        return ([self rightPanelController]);
+    if (![self isViewLoaded] || ![self panelControllerForSide:side] || [self interactiveRevealSide] != MSSPSideDisplayedNone || _panTracker.tracking || [self transitionRunning])
+        return ;
+    
+    [self setInteractiveRevealSide:side];
+    [self setInteractiveRevealStartSide:[self sideDisplayed]];
+    [self setPanHysteresisTranslation:0];
+    [self setPanOverscrollTranslation:0];
+    [self setNextSlideType:MSSPTransitionTypeInteractive];
+    [self beginSlide];
 }
 
 /**
- *  Return the panel maximum width for a side.
- *
- *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *  End an interactive reveal: the panel is opened or closed with an animation.
  *
- *  @return The panel maximum width.
+ *  @param velocity The velocity of the reveal, in panel widths per second. It is positive when the panel is opening.
  */
-- (NSUInteger)panelMaximumWithForSide:(MSSPSideDisplayed)side
+- (void)finishInteractiveRevealWithVelocity:(CGFloat)velocity
 {
-    NSParameterAssert(side != MSSPSideDisplayedNone);
+    MSSPPanelEngine     engine;
+    BOOL                shouldOpen;
+    MSSPSideDisplayed   side;
     
-    if (side == MSSPSideDisplayedLeft)
-        return ([self leftPanelMaximumWidth]);
+    if ((side = [self interactiveRevealSide]) == MSSPSideDisplayedNone)
+        return ;
+    
+    if (velocity >= g_interactiveRevealFlingVelocity)
+        shouldOpen = YES;
+    else if (velocity <= - g_interactiveRevealFlingVelocity)
+        shouldOpen = NO;
     else
-        return ([self rightPanelMaximumWidth]);
+    {
+        [self fillPanelEngine:&engine];
+        shouldOpen = (MSSPPanelEngineSnap(&engine, [[self centerView] frame].origin.x, [self panelEngineDirection]) != 0);
+    }
+    
+    [self endInteractiveRevealOnSide:(shouldOpen ? side : MSSPSideDisplayedNone)];
 }
 
 /**
- *  Return the status bar color for a side.
- *
- *  @param side The side.
- *
- *  @return The status bar color.
+ *  Cancel an interactive reveal: the side displayed when it began is displayed again with an animation.
  */
-- (UIColor *)statusBarColorForSide:(MSSPSideDisplayed)side
+- (void)cancelInteractiveReveal
 {
-    if (side == MSSPSideDisplayedLeft)
-        return ([self leftPanelStatusBarColor]);
-    else if (side == MSSPSideDisplayedRight)
-        return ([self rightPanelStatusBarColor]);
+    if ([self interactiveRevealSide] == MSSPSideDisplayedNone)
+        return ;
     
-    return ([self centerViewStatusBarColor]);
+    [self endInteractiveRevealOnSide:[self interactiveRevealStartSide]];
 }
 
 /**
- *  Return if the status bar must be displayed smoothly for a side.
+ *  End the interactive reveal and animate the center view to a side.
  *
- *  @param side The side. Must not be `MSSPSideDisplayedNone`.
- *
- *  @return YES if the status bar must be displayed smoothly, else NO.
+ *  @param side The side to display. `MSSPSideDisplayedNone` closes the opened panel.
  */
-- (BOOL)statusBarDisplayedSmoothlyForSide:(MSSPSideDisplayed)side
+- (void)endInteractiveRevealOnSide:(MSSPSideDisplayed)side
 {
-    NSParameterAssert(side != MSSPSideDisplayedNone);
+    [self setInteractiveRevealSide:MSSPSideDisplayedNone];
+    [self setInteractiveRevealStartSide:MSSPSideDisplayedNone];
+    [self setPanHysteresisTranslation:0];
+    [self setPanOverscrollTranslation:0];
+    [self setNextSlideType:MSSPTransitionTypeSettle];
     
-    if (side == MSSPSideDisplayedLeft)
-        return ([self leftPanelStatusBarDisplayedSmoothly]);
-
-    return ([self rightPanelStatusBarDisplayedSmoothly]);
+    if (side != MSSPSideDisplayedNone)
+        [self openPanelSide:side withCompletion:nil];
+    else
+        [self closePanel];
+    
+    [self endSlide];
 }
 
-#pragma mark Manage gestures
-/** @name Manage gestures */
-
 /**
- *  Ask the delegate if a gesture recognizer should receive an object representing a touch.
- *
- *  @param gestureRecognizer The gesture recognizer.
- *  @param touch             The touch.
+ *  Move the center view during an interactive reveal.
  *
- *  @return YES (the default) to allow the gesture recognizer to examine the touch object, NO to prevent the gesture recognizer from seeing this touch object.
+ *  @param fraction The visible part of the panel: 0 when it is closed, 1 when it is opened. It can be greater than 1 when the rubber band is enabled.
  */
-- (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldReceiveTouch:(UITouch *)touch
+- (void)updateRevealFraction:(CGFloat)fraction
 {
-    MSSPOpenGestureMode openGestureMode;
+    CGRect  newCenterViewFrame;
     
-    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
-        return (([self leftPanelCloseGestureMode] & [self closeGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch]) > 0);
-    else if ([self sideDisplayed] == MSSPSideDisplayedRight)
-        return (([self rightPanelCloseGestureMode] & [self closeGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch]) > 0);
+    if ([self interactiveRevealSide] == MSSPSideDisplayedNone)
+        return ;
     
-    openGestureMode = [self openGestureModeWithGestureRecognizer:gestureRecognizer andTouch:touch];
+    newCenterViewFrame = [[self centerView] frame];
+    newCenterViewFrame.origin.x = MAX(0, fraction) * [self panelMaximumWithForSide:[self interactiveRevealSide]];
     
-    if ([self leftPanelController] && [self rightPanelController])
-        return ((([self leftPanelOpenGestureMode] & openGestureMode) > 0) ||
-                (([self rightPanelOpenGestureMode] & openGestureMode) > 0));
-    else if ([self leftPanelController])
-        return (([self leftPanelOpenGestureMode] & openGestureMode) > 0);
-    else if ([self rightPanelController])
-        return (([self rightPanelOpenGestureMode] & openGestureMode) > 0);
+    if ([self interactiveRevealSide] == MSSPSideDisplayedRight)
+        newCenterViewFrame.origin.x *= -1;
     
-    return (NO);
+    [self slideCenterViewToFrame:newCenterViewFrame];
 }
 
+#pragma mark Transition queue
+/** @name Transition queue */
+
 /**
- *  Asks the delegate if two gesture recognizers should be allowed to recognize gestures simultaneously.
- *
- *  @param gestureRecognizer      An instance of a subclass of the abstract base class UIGestureRecognizer. This is the object sending the message to the delegate.
- *  @param otherGestureRecognizer An instance of a subclass of the abstract base class UIGestureRecognizer.
+ *  Add a request to the transition queue.
  *
- *  @return YES to allow both gestureRecognizer and otherGestureRecognizer to recognize their gestures simultaneously. The default implementation returns NO—no two gestures can be recognized simultaneously.
+ *  @param side       The side to display. `MSSPSideDisplayedNone` closes the opened panel.
+ *  @param animated   `YES` to animate the transition, else `NO`.
+ *  @param completion A block object to be executed when the request is done.
  */
-- (BOOL)gestureRecognizer:(UIGestureRecognizer *)gestureRecognizer shouldRecognizeSimultaneouslyWithGestureRecognizer:(UIGestureRecognizer *)otherGestureRecognizer
+- (void)enqueueTransitionToSide:(MSSPSideDisplayed)side animated:(BOOL)animated withCompletion:(void (^)(MSSPTransitionResult result))completion
 {
-    if ([[self delegate] respondsToSelector:@selector(slidingPanelController:gestureRecognizer:shouldRecognizeSimultaneouslyWithGestureRecognizer:)])
-        return ([[self delegate] slidingPanelController:self gestureRecognizer:gestureRecognizer shouldRecognizeSimultaneouslyWithGestureRecognizer:otherGestureRecognizer]);
+    void    (^boundCompletion)(MSSPSideDisplayed, MSSPTransitionResult);
     
-    return (NO);
+    if (completion)
+    {
+        boundCompletion = ^(MSSPSideDisplayed sideReached, MSSPTransitionResult result)
+        {
+            completion(sideReached == side ? result : MSSPTransitionResultSuperseded);
+        };
+        
+        [[self transitionCompletions] addObject:[boundCompletion copy]];
+    }
+    
+    [self setTransitionPendingSide:side];
+    [self setTransitionPendingAnimated:animated];
+    [self setTransitionPending:YES];
+    
+    if (![self transitionRunning])
+        [self runPendingTransition];
 }
 
 /**
- *  Return the list of the possible closing gestures recognized.
- *
- *  @param gestureRecognizer The gesture recognizer.
- *  @param touch             The touch.
- *
- *  @return The closing gestures possibly recognized.
+ *  Start the pending transition if there is one, else execute the remaining completion blocks.
  */
-- (MSSPCloseGestureMode)closeGestureModeWithGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer andTouch:(UITouch *)touch
+- (void)runPendingTransition
 {
-    MSSPCloseGestureMode    closeGestureMode;
-    NSMutableArray          *navigationBarList;
+    NSArray                             *completions;
+    void                                (^completionBlock)(MSSPTransitionResult);
+    void                                (^finishBlock)(BOOL);
+    CGFloat                             restingOriginX;
+    MSSPSideDisplayed                   side;
+    __weak MSSlidingPanelController     *weakSelf;
     
-    if (![self isTouchInCenterView:touch])
-        return (MSSPCloseGestureModeNone);
+    weakSelf = self;
+    completions = [[self transitionCompletions] copy];
+    side = [self transitionPendingSide];
+    [[self transitionCompletions] removeAllObjects];
     
-    closeGestureMode = MSSPCloseGestureModeNone;
-    navigationBarList = [[NSMutableArray alloc] init];
-    [self fillNavigationBarsList:navigationBarList withSubviewsOfView:[self centerView]];
+    completionBlock = ^(MSSPTransitionResult result)
+    {
+        void    (^completion)(MSSPSideDisplayed, MSSPTransitionResult);
+        
+        [weakSelf enterStallPhase:MSSPStallPhaseCompletionBlock];
+        
+        for (completion in completions)
+            completion(side, result);
+        
+        [weakSelf exitStallPhase];
+    };
     
-    if (gestureRecognizer == [self tapGestureRecognizer])
+    if (![self transitionPending])
     {
-        if ([self isTouch:touch inNavigationBars:navigationBarList])
-            closeGestureMode |= MSSPCloseGestureModeTapNavBar;
-        else
-            closeGestureMode |= MSSPCloseGestureModeTapContent;
+        completionBlock(MSSPTransitionResultUnchanged);
+        return ;
     }
     
-    if (gestureRecognizer == [self panGestureRecognizer])
+    [self setTransitionPending:NO];
+    
+    if (side == MSSPSideDisplayedLeft)
+        restingOriginX = [self leftPanelMaximumWidth];
+    else if (side == MSSPSideDisplayedRight)
+        restingOriginX = - (CGFloat)[self rightPanelMaximumWidth];
+    else
+        restingOriginX = 0;
+    
+    if ([self sideDisplayed] == side && [[self centerView] frame].origin.x == restingOriginX)
     {
-        if ([self isTouch:touch inNavigationBars:navigationBarList])
-        {
-            closeGestureMode |= MSSPCloseGestureModePanNavBar;
-            [self setPanTouchLocation:MSSPPanTouchLocationNavBar];
-        }
-        else
-        {
-            closeGestureMode |= MSSPCloseGestureModePanContent;
-            [self setPanTouchLocation:MSSPPanTouchLocationContent];
-        }
+        completionBlock(MSSPTransitionResultUnchanged);
+        return ;
     }
     
-    return (closeGestureMode);
+    if (![self transitionPendingAnimated])
+    {
+        [self displaySideWithoutAnimation:side];
+        completionBlock([self sideDisplayed] == side ? MSSPTransitionResultCompleted : MSSPTransitionResultCancelled);
+        [self runPendingTransition];
+        return ;
+    }
+    
+    [self setTransitionRunning:YES];
+    
+    finishBlock = ^(BOOL finished)
+    {
+        completionBlock(finished ? MSSPTransitionResultCompleted : MSSPTransitionResultCancelled);
+        
+        [weakSelf setTransitionRunning:NO];
+        [weakSelf runPendingTransition];
+    };
+    
+    if (side == MSSPSideDisplayedNone)
+        [self animateClosePanelWithCompletion:finishBlock];
+    else
+        [self openPanelSide:side withCompletion:finishBlock andStatusBarColorUpdate:YES];
 }
 
 /**
- *  Verify if the touch is within the center view.
+ *  Return a transition completion block which executes the completion block of an action only if the action has reached its side, like before the actions were queued.
  *
- *  @param touch The touch
+ *  @param completion The completion block of the action. May be `nil`.
+ *  @param side       The side requested by the action.
  *
- *  @return Return YES if the touch is whthin, else return NO.
+ *  @return The transition completion block, or `nil` if `completion` is `nil`.
  */
-- (BOOL)isTouchInCenterView:(UITouch *)touch
+- (void (^)(MSSPTransitionResult result))transitionCompletionWithActionCompletion:(void (^)(void))completion toSide:(MSSPSideDisplayed)side
 {
-    CGRect  centerViewFrame;
-    CGPoint touchPoint;
-    
-    touchPoint = [touch locationInView:[self view]];
-    centerViewFrame = [[self centerView] frame];
+    if (!completion)
+        return (nil);
     
-    return (CGRectContainsPoint(centerViewFrame, touchPoint));
+    return (^(MSSPTransitionResult result)
+            {
+                if (result == MSSPTransitionResultCompleted || (result == MSSPTransitionResultUnchanged && side != MSSPSideDisplayedNone))
+                    completion();
+            });
 }
 
+#pragma mark Adaptive quality
+/** @name Adaptive quality */
+
 /**
- *  Verify if the touch is within an navigation bar.
- *
- *  @param touch              The touch.
- *  @param navigationBarsList The list of the navigation bar.
+ *  Set if the optional effects are dropped when the slides miss frames.
  *
- *  @return Return YES if the touch is within, else return NO.
+ *  @param adaptiveQualityEnabled YES to drop the effects, else NO.
  */
-- (BOOL)isTouch:(UITouch *)touch inNavigationBars:(NSArray *)navigationBarsList
+- (void)setAdaptiveQualityEnabled:(BOOL)adaptiveQualityEnabled
 {
-    UINavigationBar *navigationBar;
-    CGRect          navigationBarFrame;
-    CGPoint         touchPoint;
+    _adaptiveQualityEnabled = adaptiveQualityEnabled;
     
-    touchPoint = [touch locationInView:[self view]];
-    for (navigationBar in navigationBarsList)
-    {
-        navigationBarFrame = [navigationBar convertRect:[navigationBar bounds] toView:[self view]];
+    MSSPQualityGovernorInit(&_qualityGovernor, _qualityGovernor.frameBudget);
+    [self applyQualityLevel];
+}
 
-        if (CGRectContainsPoint(navigationBarFrame, touchPoint))
-            return (YES);
+/**
+ *  Apply the effects corresponding to the quality level.
+ */
+- (void)applyQualityLevel
+{
+    MSSPQualityLevel    qualityLevel;
+    BOOL                snapshotNeeded;
+    
+    qualityLevel = ([self adaptiveQualityEnabled] ? _qualityGovernor.level : MSSPQualityLevelFull);
+    
+    if (qualityLevel != [self qualityLevel])
+    {
+        [self setQualityLevel:qualityLevel];
+        [self applyCenterViewEffectsSettings];
+        
+        if ([self sideDisplayed] != MSSPSideDisplayedNone)
+            [self adjustStatusBarColor];
     }
     
-    return (NO);
+    snapshotNeeded = (qualityLevel >= MSSPQualityLevelSnapshotCenter && [self slidesCount] > 0);
+    
+    if (snapshotNeeded && ![self centerViewSnapshot] && [[self centerViewController] isViewLoaded])
+    {
+        [self setCenterViewSnapshot:[[[self centerViewController] view] snapshotViewAfterScreenUpdates:NO]];
+        [[self centerViewSnapshot] setFrame:[[[self centerViewController] view] frame]];
+        [[self centerView] addSubview:[self centerViewSnapshot]];
+        [[[self centerViewController] view] setHidden:YES];
+    }
+    else if (!snapshotNeeded && [self centerViewSnapshot])
+    {
+        [[[self centerViewController] view] setHidden:NO];
+        [[self centerViewSnapshot] removeFromSuperview];
+        [self setCenterViewSnapshot:nil];
+    }
 }
 
 /**
- *  Return the list of the possible opening gestures recognized.
- *
- *  @param gestureRecognizer The gesture recognizer.
- *  @param touch             The touch.
- *
- *  @return The opening gestures possibly recognized.
+ *  Tell that a slide, interactive or animated, begins.
  */
-- (MSSPOpenGestureMode)openGestureModeWithGestureRecognizer:(UIGestureRecognizer *)gestureRecognizer andTouch:(UITouch *)touch
+- (void)beginSlide
 {
-    MSSPOpenGestureMode     openGestureMode;
-    NSMutableArray          *navigationBarList;
+    MSSlidingPanelFrameMonitorTarget    *frameMonitorTarget;
+    MSSPQualityLevel                    minimumLevel;
+    MSSPTransitionType                  transitionType;
     
-    if (![self isTouchInCenterView:touch])
-        return (MSSPOpenGestureModeNone);
+    transitionType = [self nextSlideType];
+    [self setNextSlideType:MSSPTransitionTypeProgrammatic];
+    [self setSlideType:transitionType];
     
-    openGestureMode = MSSPOpenGestureModeNone;
-    navigationBarList = [[NSMutableArray alloc] init];
-    [self fillNavigationBarsList:navigationBarList withSubviewsOfView:[self centerView]];
+    [self setSlidesCount:[self slidesCount] + 1];
+    MSSPStallMonitorBeginTransition(&_stallMonitor);
     
-    if (gestureRecognizer == [self panGestureRecognizer])
+    if ([self frameMonitor])
     {
-        if ([self isTouch:touch inNavigationBars:navigationBarList])
-        {
-            openGestureMode |= MSSPOpenGestureModePanNavBar;
-            [self setPanTouchLocation:MSSPPanTouchLocationNavBar];
-        }
-        else
+        if (transitionType != _frameRateMeter.type)
         {
-            openGestureMode |= MSSPOpenGestureModePanContent;
-            [self setPanTouchLocation:MSSPPanTouchLocationContent];
+            [self beginFrameRateMeasureOfTransitionType:transitionType];
+            [self applyFrameRateRangeOfTransitionType:transitionType];
         }
+        
+        return ;
     }
     
-    return (openGestureMode);
+    if (![self adaptiveQualityEnabled] && ![self frameRateSink] && [self maximumFrameRate] <= 60)
+        return ;
+    
+    if ([self adaptiveQualityEnabled])
+    {
+        minimumLevel = MSSPQualityLevelFull;
+        
+        if ([[NSProcessInfo processInfo] respondsToSelector:@selector(isLowPowerModeEnabled)] && [[NSProcessInfo processInfo] isLowPowerModeEnabled])
+            minimumLevel = MSSPQualityLevelNoShadow;
+        
+        MSSPQualityGovernorSetMinimumLevel(&_qualityGovernor, minimumLevel);
+    }
+    
+    [self setFrameMonitorTimestamp:0];
+    [self setFrameMonitorCenterViewOriginX:[([[[self centerView] layer] presentationLayer] ?: [[self centerView] layer]) frame].origin.x];
+    frameMonitorTarget = [[MSSlidingPanelFrameMonitorTarget alloc] init];
+    [frameMonitorTarget setSlidingPanelController:self];
+    [self setFrameMonitor:[CADisplayLink displayLinkWithTarget:frameMonitorTarget selector:@selector(frameMonitorFired:)]];
+    [self beginFrameRateMeasureOfTransitionType:transitionType];
+    [self applyFrameRateRangeOfTransitionType:transitionType];
+    [[self frameMonitor] addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+    
+    [self applyQualityLevel];
 }
 
 /**
- *  Called when a panning is recognized.
- *
- *  @param panGestureRecognizer The gesture recognizer.
+ *  Tell that a slide, interactive or animated, ends.
  */
-- (void)panGestureRecognized:(UIPanGestureRecognizer *)panGestureRecognizer
+- (void)endSlide
 {
-    CGRect  newCenterViewFrame;
-    CGFloat translationX;
+    if ([self slidesCount] == 0)
+        return ;
     
-    if ([panGestureRecognizer state] == UIGestureRecognizerStateBegan)
-        [self setPanTranslation:CGPointZero];
+    [self setSlidesCount:[self slidesCount] - 1];
+    MSSPStallMonitorEndTransition(&_stallMonitor);
     
-    translationX = [panGestureRecognizer translationInView:[self view]].x - [self panTranslation].x;
-    [self setPanTranslation:[panGestureRecognizer translationInView:[self view]]];
+    if ([self slidesCount] > 0)
+        return ;
     
-    newCenterViewFrame = [[self centerView] frame];
-    newCenterViewFrame.origin.x += translationX;
+    [self stopFrameMonitor];
+    [self applyQualityLevel];
+}
+
+/**
+ *  Report the frame rate of the measured transition and stop the frame monitor.
+ */
+- (void)stopFrameMonitor
+{
+    [self endFrameRateMeasure];
+    [[self frameMonitor] invalidate];
+    [self setFrameMonitor:nil];
+}
+
+/**
+ *  Called at each frame while a slide is running.
+ *
+ *  @param displayLink The display link.
+ */
+- (void)frameMonitorFired:(CADisplayLink *)displayLink
+{
+    CGFloat         centerViewOriginX;
+    CFTimeInterval  frameDuration;
+    CFTimeInterval  targetTimestamp;
     
-    [self panGestureVerifyAuthorizationForNewCenterViewFrame:&newCenterViewFrame];
-    [self adjustStatusBarColor];
-    [[self centerView] setFrame:newCenterViewFrame];
+    frameDuration = [displayLink timestamp] - [self frameMonitorTimestamp];
+    centerViewOriginX = [([[[self centerView] layer] presentationLayer] ?: [[self centerView] layer]) frame].origin.x;
     
-    if ([panGestureRecognizer state] == UIGestureRecognizerStateEnded)
+    // The display link may fire more often than the center view moves: only the frames which moved it are measured.
+    if (centerViewOriginX != [self frameMonitorCenterViewOriginX])
     {
-        if ([self sideDisplayed] == MSSPSideDisplayedLeft)
-        {
-            if ([[self centerView] frame].origin.x <= [self leftPanelMaximumWidth] / 2)
-                [self closePanel];
-            else
-                [self openLeftPanel];
-        }
-        else if ([self sideDisplayed] == MSSPSideDisplayedRight)
-        {
-            if ([[self centerView] frame].origin.x >= - (NSInteger)[self rightPanelMaximumWidth] / 2)
-                [self closePanel];
-            else
-                [self openRightPanel];
-        }
-        else
-            [self closePanel];
+        MSSPFrameRateMeterRecordFrame(&_frameRateMeter, [displayLink timestamp]);
+        [self setFrameMonitorCenterViewOriginX:centerViewOriginX];
+    }
+    
+    if ([self adaptiveQualityEnabled] && [self frameMonitorTimestamp] > 0)
+    {
+        // The display link fires at the frame rate requested by the slide, which may be lower than the refresh rate given by its duration.
+        targetTimestamp = ([displayLink respondsToSelector:@selector(targetTimestamp)] ? [displayLink targetTimestamp] : 0);
+        MSSPQualityGovernorSetFrameBudget(&_qualityGovernor, MSSPQualityGovernorFrameBudgetOfFrame([displayLink timestamp], targetTimestamp, [displayLink duration]));
+        
+        if (MSSPQualityGovernorRecordFrame(&_qualityGovernor, frameDuration) != [self qualityLevel])
+            [self applyQualityLevel];
     }
+    
+    [self setFrameMonitorTimestamp:[displayLink timestamp]];
 }
 
+#pragma mark Frame rate
+/** @name Frame rate */
+
 /**
- *  Verify if the new frame is authorized to have these values.
+ *  Request the frame rate range of a type of transition to the frame monitor.
  *
- *  @param newCenterViewFrame The new center view frame.
+ *  @param transitionType The type of transition.
  */
-- (void)panGestureVerifyAuthorizationForNewCenterViewFrame:(CGRect *)newCenterViewFrame
+- (void)applyFrameRateRangeOfTransitionType:(MSSPTransitionType)transitionType
 {
-    if ([self leftPanelController] && newCenterViewFrame->origin.x > [self leftPanelMaximumWidth])
-        newCenterViewFrame->origin.x = [self leftPanelMaximumWidth];
-    else if (![self leftPanelController] && newCenterViewFrame->origin.x > 0)
-        newCenterViewFrame->origin.x = 0;
+    MSSPFrameRateRange  frameRateRange;
     
-    if ([self rightPanelController] && newCenterViewFrame->origin.x < - (NSInteger)[self rightPanelMaximumWidth])
-        newCenterViewFrame->origin.x = - (NSInteger)[self rightPanelMaximumWidth];
-    else if (![self rightPanelController] && newCenterViewFrame->origin.x < 0)
-        newCenterViewFrame->origin.x = 0;
+    frameRateRange = MSSPFrameRateRangeFit([self frameRateRangeForTransitionType:transitionType], [self maximumFrameRate]);
     
-    if ([[self centerView] frame].origin.x <= 0 && newCenterViewFrame->origin.x > 0)
-    {   
-        if ([self sideDisplayed] != MSSPSideDisplayedNone && [[self delegate] respondsToSelector:@selector(slidingPanelController:hasClosedSide:)])
-            [[self delegate] slidingPanelController:self hasClosedSide:[self sideDisplayed]];
-        
-        if (!([self leftPanelOpenGestureMode] & [self panTouchLocation]))
-            newCenterViewFrame->origin.x = 0;
-        else
-        {
-            [self loadLeftPanel];
-            
-            if ([[self delegate] respondsToSelector:@selector(slidingPanelController:beginsToBringOutSide:)])
-                [[self delegate] slidingPanelController:self beginsToBringOutSide:[self sideDisplayed]];
-        }
-    }
-    else if ([[self centerView] frame].origin.x >= 0 && newCenterViewFrame->origin.x < 0)
-    {
-        if ([self sideDisplayed] != MSSPSideDisplayedNone && [[self delegate] respondsToSelector:@selector(slidingPanelController:hasClosedSide:)])
-            [[self delegate] slidingPanelController:self hasClosedSide:[self sideDisplayed]];
-        
-        if (!([self rightPanelOpenGestureMode] & [self panTouchLocation]))
-            newCenterViewFrame->origin.x = 0;
-        else
-        {
-            [self loadRightPanel];
-            
-            if ([[self delegate] respondsToSelector:@selector(slidingPanelController:beginsToBringOutSide:)])
-                [[self delegate] slidingPanelController:self beginsToBringOutSide:[self sideDisplayed]];
-        }
+#if defined(__IPHONE_15_0) && __IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_15_0
+    if (@available(iOS 15.0, *))
+    {
+        [[self frameMonitor] setPreferredFrameRateRange:CAFrameRateRangeMake(frameRateRange.minimum, frameRateRange.maximum, frameRateRange.preferred)];
+        return ;
     }
+#endif
+    
+    if ([[self frameMonitor] respondsToSelector:@selector(setPreferredFramesPerSecond:)])
+        [[self frameMonitor] setPreferredFramesPerSecond:(NSInteger)frameRateRange.preferred];
 }
 
 /**
- *  Set the gesture recognizers.
+ *  Request the frame rate range of the running slide to an animation.
+ *
+ *  @param animation The animation.
  */
-- (void)setGestureRecognizers
+- (void)applyFrameRateRangeToAnimation:(CAAnimation *)animation
 {
-    if (![self panGestureRecognizer])
-    {
-        [self setPanGestureRecognizer:[[UIPanGestureRecognizer alloc] initWithTarget:self action:@selector(panGestureRecognized:)]];
-        [[self panGestureRecognizer] setDelegate:self];
-        [[self panGestureRecognizer] setMinimumNumberOfTouches:1];
-        [[self panGestureRecognizer] setMaximumNumberOfTouches:1];
-    }
+#if defined(__IPHONE_15_0) && __IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_15_0
+    MSSPFrameRateRange  frameRateRange;
     
-    if (![self tapGestureRecognizer])
+    if (@available(iOS 15.0, *))
     {
-        [self setTapGestureRecognizer:[[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(tapGestureRecognized:)]];
-        [[self tapGestureRecognizer] setDelegate:self];
-        [[self tapGestureRecognizer] setNumberOfTapsRequired:1];
-        [[self tapGestureRecognizer] setNumberOfTouchesRequired:1];
+        frameRateRange = MSSPFrameRateRangeFit([self frameRateRangeForTransitionType:[self slideType]], [self maximumFrameRate]);
+        [animation setPreferredFrameRateRange:CAFrameRateRangeMake(frameRateRange.minimum, frameRateRange.maximum, frameRateRange.preferred)];
     }
-    
-    [[self view] addGestureRecognizer:[self panGestureRecognizer]];
-    [[self view] addGestureRecognizer:[self tapGestureRecognizer]];
+#endif
 }
 
 /**
- *  Called when a tap is recognized.
+ *  Report the frame rate achieved by the measured transition to the frame rate sink, and begin to measure another one.
  *
- *  @param tapGestureRecognizer The gesture recognizer.
+ *  @param transitionType The type of the next transition.
  */
-- (void)tapGestureRecognized:(UITapGestureRecognizer *)__unused tapGestureRecognizer
+- (void)beginFrameRateMeasureOfTransitionType:(MSSPTransitionType)transitionType
 {
-    [self closePanel];
+    [self endFrameRateMeasure];
+    MSSPFrameRateMeterBegin(&_frameRateMeter, transitionType, [self maximumFrameRate]);
 }
 
-#pragma mark Load and unload panels
-/** @name Load and unload panels */
-
 /**
- *  Load the left panel.
+ *  Report the frame rate achieved by the measured transition to the frame rate sink.
  */
-- (void)loadLeftPanel
+- (void)endFrameRateMeasure
 {
-    [self loadPanelForSide:MSSPSideDisplayedLeft];
+    MSSPFrameRateReport report;
+    
+    if (MSSPFrameRateMeterEnd(&_frameRateMeter, &report) && [self frameRateSink])
+        [self frameRateSink](report);
 }
 
 /**
- *  Load the panel corresponding to the side.
+ *  Return the range of frame rates requested to the display while a type of transition runs.
  *
- *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param transitionType The type of transition.
+ *
+ *  @return The range of frame rates.
  */
-- (void)loadPanelForSide:(MSSPSideDisplayed)side
+- (MSSPFrameRateRange)frameRateRangeForTransitionType:(MSSPTransitionType)transitionType
 {
-    if (side == MSSPSideDisplayedNone)
-        return ;
+    NSParameterAssert(transitionType < MSSP_TRANSITION_TYPES_COUNT);
     
-    if (![self panelControllerForSide:side] || [self sideDisplayed] == side)
-        return ;
-    
-    if ([self sideDisplayed] != MSSPSideDisplayedNone)
-        [self unloadPanelForSide:[self sideDisplayed]];
+    return (_frameRateRanges[transitionType]);
+}
+
+/**
+ *  Return the maximum frame rate of the screen.
+ *
+ *  @return The maximum frame rate, in frames per second.
+ */
+- (double)maximumFrameRate
+{
+    if ([[UIScreen mainScreen] respondsToSelector:@selector(maximumFramesPerSecond)])
+        return ([[UIScreen mainScreen] maximumFramesPerSecond]);
     
-    if (side == MSSPSideDisplayedLeft)
-    {
-        [[[self leftPanelController] view] setFrame:CGRectMake(0, 0, [self leftPanelMaximumWidth], [[self view] bounds].size.height)];
-        [[[self leftPanelController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleHeight | UIViewAutoresizingFlexibleRightMargin)];
-    }
-    else
-    {
-        [[[self rightPanelController] view] setFrame:CGRectMake([[self view] bounds].size.width - [self rightPanelMaximumWidth], 0, [self rightPanelMaximumWidth], [[self view] bounds].size.height)];
-        [[[self rightPanelController] view] setAutoresizingMask:(UIViewAutoresizingFlexibleHeight | UIViewAutoresizingFlexibleLeftMargin)];
-    }
+    return (60);
+}
+
+/**
+ *  Set the range of frame rates requested to the display while a type of transition runs.
+ *
+ *  @param frameRateRange The range of frame rates.
+ *  @param transitionType The type of transition.
+ */
+- (void)setFrameRateRange:(MSSPFrameRateRange)frameRateRange forTransitionType:(MSSPTransitionType)transitionType
+{
+    NSParameterAssert(transitionType < MSSP_TRANSITION_TYPES_COUNT);
     
-    [[self view] addSubview:[[self panelControllerForSide:side] view]];
-    [[self view] sendSubviewToBack:[[self panelControllerForSide:side] view]];
+    _frameRateRanges[transitionType] = frameRateRange;
     
-    [self setSideDisplayed:side];
+    if ([self frameMonitor] && _frameRateMeter.type == transitionType)
+        [self applyFrameRateRangeOfTransitionType:transitionType];
 }
 
+#pragma mark Panel engine
+/** @name Panel engine */
+
 /**
- *  Load the right panel.
+ *  Fill the panel engine with the current panels and settings. The status bar colors are not filled.
+ *
+ *  @param engine The engine.
  */
-- (void)loadRightPanel
+- (void)fillPanelEngine:(MSSPPanelEngine *)engine
 {
-    [self loadPanelForSide:MSSPSideDisplayedRight];
+    engine->leftPanelWidth = [self leftPanelMaximumWidth];
+    engine->rightPanelWidth = [self rightPanelMaximumWidth];
+    engine->hasLeftPanel = ([self leftPanelController] != nil);
+    engine->hasRightPanel = ([self rightPanelController] != nil);
+    engine->rubberBandEnabled = [self panRubberBandEnabled];
+    engine->switchHysteresis = [self panelSwitchHysteresis];
+    engine->revealStyleEvaluator = [self revealStyleEvaluator];
 }
 
 /**
- *  Unload the left panel.
+ *  Return the displayed side as expected by the panel engine.
+ *
+ *  @return 1 if the left panel is displayed, -1 if the right one is, else 0.
  */
-- (void)unloadLeftPanel
+- (int)panelEngineDirection
 {
-    [self unloadPanelForSide:MSSPSideDisplayedLeft];
+    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
+        return (1);
+    else if ([self sideDisplayed] == MSSPSideDisplayedRight)
+        return (-1);
+    
+    return (0);
 }
 
+#pragma mark Stall watchdog
+/** @name Stall watchdog */
+
 /**
- *  Unload the panel corresponding to the side.
+ *  Forward the activities of the main run loop to the sliding panel controller.
  *
- *  @param side The side. Must not be `MSSPSideDisplayedNone`.
+ *  @param observer The observer.
+ *  @param activity The step of the run loop.
+ *  @param info     The sliding panel controller.
  */
-- (void)unloadPanelForSide:(MSSPSideDisplayed)side
+static void MSSPStallObserverCallBack(CFRunLoopObserverRef __unused observer, CFRunLoopActivity activity, void *info)
 {
-    if (side == MSSPSideDisplayedNone)
-        return ;
-    
-    if (![self panelControllerForSide:side] || [self sideDisplayed] != side)
-        return ;
-    
-    [[[self panelControllerForSide:side] view] removeFromSuperview];
-    
-    [self setSideDisplayed:MSSPSideDisplayedNone];
+    [(__bridge MSSlidingPanelController *)info stallObserverFiredWithActivity:activity];
 }
 
 /**
- *  Unload the right panel.
+ *  Tell that a phase of a transition begins on the main thread.
+ *
+ *  @param phase The phase.
  */
-- (void)unloadRightPanel
+- (void)enterStallPhase:(MSSPStallPhase)phase
 {
-    [self unloadPanelForSide:MSSPSideDisplayedRight];
+    if ([self stallWatchdogEnabled])
+        MSSPStallMonitorEnterPhase(&_stallMonitor, phase, CACurrentMediaTime());
 }
 
-#pragma mark Actions
-/** @name Actions */
+/**
+ *  Tell that the innermost phase of a transition ends on the main thread.
+ */
+- (void)exitStallPhase
+{
+    if ([self stallWatchdogEnabled])
+        MSSPStallMonitorExitPhase(&_stallMonitor, CACurrentMediaTime());
+}
 
 /**
- *  Close the opened panel.
+ *  Called by the stall observer at each step of the main run loop.
+ *
+ *  The run loop is considered busy from the moment it wakes up until it waits again, or until it starts a new pass without waiting.
+ *
+ *  @param activity The step of the run loop.
  */
-- (void)closePanel
+- (void)stallObserverFiredWithActivity:(CFRunLoopActivity)activity
 {
-    [self closePanelWithCompletion:nil];
+    MSSPStall   stall;
+    
+    if (activity == kCFRunLoopAfterWaiting)
+        MSSPStallMonitorResume(&_stallMonitor, CACurrentMediaTime());
+    else if (MSSPStallMonitorHeartbeat(&_stallMonitor, CACurrentMediaTime(), &stall) && [self stallSink])
+        [self stallSink](stall);
 }
 
 /**
- *  Close the opened panel.
+ *  Set if the stalls of the main thread are watched during the slides.
  *
- *  @param completion A block object to be executed when the panel is closed.
+ *  @param stallWatchdogEnabled YES to watch the stalls, else NO.
  */
-- (void)closePanelWithCompletion:(void (^)(void))completion
+- (void)setStallWatchdogEnabled:(BOOL)stallWatchdogEnabled
 {
-    void    (^animationBlock)(void);
-    CGFloat animationLength;
-    CGSize  centerViewSize;
-    void    (^completionBlock)(BOOL);
+    CFRunLoopObserverContext    context = {0, (__bridge void *)self, NULL, NULL, NULL};
     
-    if (![self centerViewController] || [self sideDisplayed] == MSSPSideDisplayedNone)
-        return ;
+    _stallWatchdogEnabled = stallWatchdogEnabled;
     
-    centerViewSize = [[self centerView] frame].size;
-
-    animationBlock = ^()
+    if ([self stallObserver])
     {
-        if ([self statusBarDisplayedSmoothlyForSide:[self sideDisplayed]])
-            [[self statusBarView] setBackgroundColor:[self statusBarColorForSide:MSSPSideDisplayedNone]];
-        
-        [[self centerView] setFrame:CGRectMake(0, 0, centerViewSize.width, centerViewSize.height)];
-    };
+        CFRunLoopObserverInvalidate([self stallObserver]);
+        CFRelease([self stallObserver]);
+        [self setStallObserver:NULL];
+    }
     
-    completionBlock = ^(BOOL finished)
-    {
-        if (finished)
-        {
-            if ([[self delegate] respondsToSelector:@selector(slidingPanelController:hasClosedSide:)])
-                [[self delegate] slidingPanelController:self hasClosedSide:[self sideDisplayed]];
-            
-            [self unloadPanelForSide:[self sideDisplayed]];
-            [self adjustStatusBarColor];
-            
-            if (completion)
-                completion();
-        }
-    };
+    MSSPStallMonitorInit(&_stallMonitor, [self stallThreshold]);
     
-    if ([self sideDisplayed] == MSSPSideDisplayedLeft)
-        animationLength = [[self centerView] frame].origin.x;
-    else
-        animationLength = -[[self centerView] frame].origin.x;
+    if (!stallWatchdogEnabled)
+        return ;
+    
+    _stallMonitor.transitionsCount = [self slidesCount];
     
-    [UIView animateWithDuration:[self animationDurationForLength:animationLength] animations:animationBlock completion:completionBlock];
+    [self setStallObserver:CFRunLoopObserverCreate(kCFAllocatorDefault, kCFRunLoopBeforeTimers | kCFRunLoopBeforeWaiting | kCFRunLoopAfterWaiting, true, LONG_MAX, MSSPStallObserverCallBack, &context)];
+    CFRunLoopAddObserver(CFRunLoopGetMain(), [self stallObserver], kCFRunLoopCommonModes);
 }
 
 /**
- *  Open the left panel.
+ *  Set the duration from which the work of the main run loop is a stall.
+ *
+ *  @param stallThreshold The duration.
  */
-- (void)openLeftPanel
+- (void)setStallThreshold:(NSTimeInterval)stallThreshold
 {
-    [self openLeftPanelWithCompletion:nil];
+    _stallThreshold = stallThreshold;
+    _stallMonitor.threshold = stallThreshold;
 }
 
+#pragma mark Delegate notifications
+/** @name Delegate notifications */
+
 /**
- *  Open the left panel.
+ *  Tell the delegate that a side begins to bring out.
  *
- *  @param completion A block object to be executed when the panel is opened.
+ *  @param side The side.
  */
-- (void)openLeftPanelWithCompletion:(void (^)(void))completion
+- (void)notifyDelegateBeginsToBringOutSide:(MSSPSideDisplayed)side
 {
-    [self openPanelSide:MSSPSideDisplayedLeft withCompletion:completion];
+    if (![[self delegate] respondsToSelector:@selector(slidingPanelController:beginsToBringOutSide:)])
+        return ;
+    
+    [self enterStallPhase:MSSPStallPhaseDelegateCallback];
+    [[self delegate] slidingPanelController:self beginsToBringOutSide:side];
+    [self exitStallPhase];
 }
 
 /**
- *  Open the panel corresponding to the side.
+ *  Tell the delegate that a side has been closed.
  *
- *  @param side       The side. Must not be `MSSPSideDisplayedNone`.
- *  @param completion A block object to be executed when the panel is opened.
+ *  @param side The side.
  */
-- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion
+- (void)notifyDelegateHasClosedSide:(MSSPSideDisplayed)side
 {
-    [self openPanelSide:side withCompletion:completion andStatusBarColorUpdate:YES];
+    if (![[self delegate] respondsToSelector:@selector(slidingPanelController:hasClosedSide:)])
+        return ;
+    
+    [self enterStallPhase:MSSPStallPhaseDelegateCallback];
+    [[self delegate] slidingPanelController:self hasClosedSide:side];
+    [self exitStallPhase];
 }
 
 /**
- *  Open the panel corresponding to the side.
+ *  Tell the delegate that a side has been opened.
  *
- *  @param side                 The side. Must not be `MSSPSideDisplayedNone`.
- *  @param completion           A block object to be executed when the panel is opened.
- *  @param statusBarColorUpdate A value which indicate if the status bar color must be updated before the animation.
+ *  @param side The side.
  */
-- (void)openPanelSide:(MSSPSideDisplayed)side withCompletion:(void (^)(void))completion andStatusBarColorUpdate:(BOOL)statusBarColorUpdate
+- (void)notifyDelegateHasOpenedSide:(MSSPSideDisplayed)side
 {
-    void                (^animationBlock)(void);
-    CGSize              centerViewSize;
-    void                (^completionBlock)(BOOL);
-    void                (^openPanelBlock)();
-    UIViewController    *panelController;
- 
-    NSParameterAssert(side != MSSPSideDisplayedNone);
+    if (![[self delegate] respondsToSelector:@selector(slidingPanelController:hasOpenedSide:)])
+        return ;
     
-    if (!(panelController = [self panelControllerForSide:side]))
+    [self enterStallPhase:MSSPStallPhaseDelegateCallback];
+    [[self delegate] slidingPanelController:self hasOpenedSide:side];
+    [self exitStallPhase];
+}
+
+/**
+ *  Tell the delegate that a side will probably bring out.
+ *
+ *  @param side         The side.
+ *  @param timeInterval The estimated time before the panel is entirely visible.
+ */
+- (void)notifyDelegateWillProbablyBringOutSide:(MSSPSideDisplayed)side inTimeInterval:(NSTimeInterval)timeInterval
+{
+    if (![[self delegate] respondsToSelector:@selector(slidingPanelController:willProbablyBringOutSide:inTimeInterval:)])
         return ;
     
-    centerViewSize = [[self centerView] frame].size;
+    [self enterStallPhase:MSSPStallPhaseDelegateCallback];
+    [[self delegate] slidingPanelController:self willProbablyBringOutSide:side inTimeInterval:timeInterval];
+    [self exitStallPhase];
+}
+
+#pragma mark Batch updates
+/** @name Batch updates */
+
+/**
+ *  Apply the changes collected during the batch updates.
+ */
+- (void)commitBatchUpdates
+{
+    NSArray                             *completions;
+    void                                (^completionBlock)(void);
+    BOOL                                closeDisplayedSide;
+    id                                  panelController;
+    NSDictionary                        *panelControllers;
+    NSNumber                            *side;
+    MSSPSideDisplayed                   sideDisplayed;
+    NSUInteger                          widthsChangedSides;
+    __weak MSSlidingPanelController     *weakSelf;
+    
+    weakSelf = self;
+    completions = [[self batchCompletions] copy];
+    panelControllers = [[self batchPanelControllers] copy];
+    widthsChangedSides = [self batchWidthsChangedSides];
     
-    animationBlock = ^()
+    [[self batchCompletions] removeAllObjects];
+    [[self batchPanelControllers] removeAllObjects];
+    [self setBatchWidthsChangedSides:0];
+    
+    completionBlock = ^(void)
     {
-        CGRect  frame;
-        CGFloat x;
+        void    (^completion)(void);
         
-        if ([self statusBarDisplayedSmoothlyForSide:side])
-            [[self statusBarView] setBackgroundColor:[self statusBarColorForSide:side]];
-        
-        if ([[panelController view] frame].size.width != [self panelMaximumWithForSide:side])
-        {
-            frame = [[panelController view] frame];
-            frame.size.width = [self panelMaximumWithForSide:side];
-            
-            if (side == MSSPSideDisplayedRight)
-                frame.origin.x = [[self centerView] frame].size.width - [self panelMaximumWithForSide:side];
-                
-            [[panelController view] setFrame:frame];
-        }
+        [weakSelf enterStallPhase:MSSPStallPhaseCompletionBlock];
         
-        if (side == MSSPSideDisplayedLeft)
-            x = [self panelMaximumWithForSide:side];
-        else
-            x = - (CGFloat)[self panelMaximumWithForSide:side];
+        for (completion in completions)
+            completion();
         
-        [[self centerView] setFrame:CGRectMake(x, 0, centerViewSize.width, centerViewSize.height)];
+        [weakSelf exitStallPhase];
     };
     
-    completionBlock = ^(BOOL finished)
-    {
-        if (finished)
-        {
-            if ([[self delegate] respondsToSelector:@selector(slidingPanelController:hasOpenedSide:)])
-                [[self delegate] slidingPanelController:self hasOpenedSide:side];
-            
-            if (completion)
-                completion();
-        }
-    };
+    sideDisplayed = [self sideDisplayed];
+    closeDisplayedSide = NO;
     
-    openPanelBlock = ^()
+    for (side in panelControllers)
     {
-        CGFloat animationLength;
-        
-        [self loadPanelForSide:side];
+        panelController = [panelControllers objectForKey:side];
         
-        if (statusBarColorUpdate)
-            [self adjustStatusBarColor];
+        if (panelController == [NSNull null])
+            panelController = nil;
         
-        if ([[self centerView] frame].origin.x == 0 && [[self delegate] respondsToSelector:@selector(slidingPanelController:beginsToBringOutSide:)])
-            [[self delegate] slidingPanelController:self beginsToBringOutSide:side];
-        
-        if (side == MSSPSideDisplayedLeft)
-            animationLength = [self leftPanelMaximumWidth] - [[self centerView] frame].origin.x;
+        if ([side unsignedIntegerValue] == sideDisplayed && !panelController && [self isViewLoaded])
+            closeDisplayedSide = YES;
         else
-            animationLength = [self rightPanelMaximumWidth] + [[self centerView] frame].origin.x;
-        
-        [UIView animateWithDuration:[self animationDurationForLength:animationLength] animations:animationBlock completion:completionBlock];
-    };
+            [self setPanelController:panelController forSide:[side unsignedIntegerValue]];
+    }
     
-    if ([self sideDisplayed] != MSSPSideDisplayedNone && [self sideDisplayed] != side)
-        [self closePanelWithCompletion:openPanelBlock];
+    if (closeDisplayedSide)
+    {
+        [self enqueueTransitionToSide:MSSPSideDisplayedNone animated:YES withCompletion:^(MSSPTransitionResult __unused result)
+         {
+             [weakSelf setPanelController:nil forSide:sideDisplayed];
+             completionBlock();
+         }];
+    }
+    else if ([self sideDisplayed] != MSSPSideDisplayedNone && (widthsChangedSides & MSSPSideMask([self sideDisplayed])))
+    {
+        [self adjustStatusBarColor];
+        [self enqueueTransitionToSide:[self sideDisplayed] animated:YES withCompletion:^(MSSPTransitionResult __unused result)
+         {
+             completionBlock();
+         }];
+    }
     else
-        openPanelBlock();
+    {
+        [self adjustStatusBarColor];
+        completionBlock();
+    }
 }
 
 /**
- *  Open the right panel.
+ *  Apply several settings changes at once.
+ *
+ *  @param updates    A block object which contains the settings changes.
+ *  @param completion A block object to be executed when every change has been applied.
  */
-- (void)openRightPanel
+- (void)performBatchUpdates:(void (^)(void))updates completion:(void (^)(void))completion
 {
-    [self openRightPanelWithCompletion:nil];
+    [self setBatchUpdatesLevel:[self batchUpdatesLevel] + 1];
+    
+    if (updates)
+        updates();
+    
+    if (completion)
+        [[self batchCompletions] addObject:[completion copy]];
+    
+    [self setBatchUpdatesLevel:[self batchUpdatesLevel] - 1];
+    
+    if ([self batchUpdatesLevel] == 0)
+        [self commitBatchUpdates];
 }
 
+#pragma mark State restoration
+/** @name State restoration */
+
 /**
- *  Open the right panel.
+ *  Encode the displayed side and the panels' widths.
  *
- *  @param completion A block object to be executed when the panel is opened.
+ *  @param coder The coder object to use to encode the state.
  */
-- (void)openRightPanelWithCompletion:(void (^)(void))completion
+- (void)encodeRestorableStateWithCoder:(NSCoder *)coder
 {
-    [self openPanelSide:MSSPSideDisplayedRight withCompletion:completion];
+    [super encodeRestorableStateWithCoder:coder];
+    
+    [coder encodeDouble:[self leftPanelMaximumWidth] forKey:MSSPRestorationKeyLeftPanelMaximumWidth];
+    [coder encodeDouble:[self rightPanelMaximumWidth] forKey:MSSPRestorationKeyRightPanelMaximumWidth];
+    [coder encodeInteger:[self sideDisplayed] forKey:MSSPRestorationKeySideDisplayed];
+}
+
+/**
+ *  Decode and restore the displayed side and the panels' widths.
+ *
+ *  @param coder The coder object to use to decode the state.
+ */
+- (void)decodeRestorableStateWithCoder:(NSCoder *)coder
+{
+    NSInteger   side;
+    
+    [super decodeRestorableStateWithCoder:coder];
+    
+    if ([coder containsValueForKey:MSSPRestorationKeyLeftPanelMaximumWidth])
+        [self setLeftPanelMaximumWidth:[coder decodeDoubleForKey:MSSPRestorationKeyLeftPanelMaximumWidth]];
+    
+    if ([coder containsValueForKey:MSSPRestorationKeyRightPanelMaximumWidth])
+        [self setRightPanelMaximumWidth:[coder decodeDoubleForKey:MSSPRestorationKeyRightPanelMaximumWidth]];
+    
+    if ([coder containsValueForKey:MSSPRestorationKeySideDisplayed])
+    {
+        side = [coder decodeIntegerForKey:MSSPRestorationKeySideDisplayed];
+        
+        if (side == MSSPSideDisplayedLeft || side == MSSPSideDisplayedRight)
+            [self setSideDisplayed:side animated:NO];
+    }
 }
 
 #pragma mark Storyboard
@@ -0,0 +1,131 @@
+//  MSSlidingPanelMenuController.h
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import <UIKit/UIKit.h>
+
+#import "MSSPMenuItem.h"
+#import "MSSPMenuSection.h"
+
+#pragma mark - Interface
+
+/**
+ *  The `MSSlidingPanelMenuController` class displays a menu made of `MSSPMenuSection` objects in a table view. It is intended to be used as a panel of a `MSSlidingPanelController`.
+ *
+ *  When new sections are set, the differences with the displayed ones are computed on a background queue, by following the sections and the items thanks to their identifiers. Only the modified rows and sections are then updated, so the menu can be updated while the panel is displayed, even with thousands of items.
+ */
+@interface MSSlidingPanelMenuController : UIViewController
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return a menu controller.
+ *
+ *  @param sections An array of `MSSPMenuSection` objects.
+ *
+ *  @return The menu controller.
+ */
+- (id)initWithSections:(NSArray *)sections;
+
+#pragma mark Menu
+/** @name Menu */
+
+/**
+ *  The sections currently displayed.
+ */
+@property (nonatomic, strong, readonly) NSArray     *sections;
+
+/**
+ *  Set the sections to display.
+ *
+ *  The sections are copied. The objects must not be modified while the update is in progress.
+ *
+ *  @param sections An array of `MSSPMenuSection` objects.
+ *  @param animated YES if the changes must be animated, else NO.
+ */
+- (void)setSections:(NSArray *)sections animated:(BOOL)animated;
+
+/**
+ *  Set the sections to display.
+ *
+ *  The sections are copied. The objects must not be modified while the update is in progress.
+ *  If several updates are requested while one is in progress, only the last sections are displayed.
+ *
+ *  @param sections   An array of `MSSPMenuSection` objects.
+ *  @param animated   YES if the changes must be animated, else NO.
+ *  @param completion Executed on the main thread once the sections are displayed. Can be `nil`.
+ */
+- (void)setSections:(NSArray *)sections animated:(BOOL)animated completion:(void (^)(void))completion;
+
+#pragma mark Appearance
+/** @name Appearance */
+
+/**
+ *  The font used to display the items' name.
+ *  By default, the value is the system font of 18 points.
+ */
+@property (nonatomic, strong)           UIFont      *itemFont;
+
+/**
+ *  The minimum height of a row.
+ *  By default, the value is 44.
+ */
+@property (nonatomic, assign)           CGFloat     minimumRowHeight;
+
+/**
+ *  The table view displaying the menu.
+ */
+@property (nonatomic, strong, readonly) UITableView *tableView;
+
+#pragma mark Customize the cells
+/** @name Customize the cells */
+
+/**
+ *  Configure a cell to display an item.
+ *
+ *  Subclasses can override this method. If the height of the cell depends on another property than the item's name, `heightForItem:inSection:withWidth:` must also be overridden.
+ *
+ *  @param cell    The cell.
+ *  @param item    The item.
+ *  @param section The section of the item.
+ */
+- (void)configureCell:(UITableViewCell *)cell forItem:(MSSPMenuItem *)item inSection:(MSSPMenuSection *)section;
+
+/**
+ *  Compute the height of the row displaying an item.
+ *
+ *  The result is cached until the name of the item or the width of the table view changes.
+ *
+ *  @param item    The item.
+ *  @param section The section of the item.
+ *  @param width   The width of the table view.
+ *
+ *  @return The height.
+ */
+- (CGFloat)heightForItem:(MSSPMenuItem *)item inSection:(MSSPMenuSection *)section withWidth:(CGFloat)width;
+
+@end
@@ -0,0 +1,1043 @@
+//  MSSlidingPanelMenuController.m
+//
+// Copyright © 2014-2015 Sebastien MICHOY and contributors.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// Redistributions of source code must retain the above copyright notice, this
+// list of conditions and the following disclaimer. Redistributions in binary
+// form must reproduce the above copyright notice, this list of conditions and
+// the following disclaimer in the documentation and/or other materials
+// provided with the distribution. Neither the name of the nor the names of
+// its contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#import "MSSlidingPanelMenuController.h"
+
+#pragma mark - Global variables
+
+NSString    *g_menuCellIdentifier = @"MSSPMenuCellIdentifier";
+CGFloat     g_menuCellAccessoryWidth = 38;
+CGFloat     g_menuCellHorizontalMargin = 15;
+CGFloat     g_menuCellVerticalMargin = 11;
+NSUInteger  g_menuUpdateMaximumChanges = 500;
+
+#pragma mark - MSSPMenuSection private interface
+
+@interface MSSPMenuSection (MSSlidingPanelMenuController)
+
+#pragma mark Items
+/** @name Items */
+
+/**
+ *  The section's items. They are not copied, so they must be read only.
+ *
+ *  @return The items.
+ */
+- (NSArray *)items;
+
+@end
+
+#pragma mark - MSSPMenuUpdate interface
+
+/**
+ *  The `MSSPMenuUpdate` class describes the changes between two versions of a menu, as they must be applied to a table view.
+ */
+@interface MSSPMenuUpdate : NSObject
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Compute and return the changes between two versions of a menu.
+ *
+ *  This method doesn't access to UIKit and can be called on any thread.
+ *
+ *  @param oldSections The sections currently displayed.
+ *  @param newSections The sections to display.
+ *
+ *  @return The changes.
+ */
++ (MSSPMenuUpdate *)menuUpdateFromSections:(NSArray *)oldSections toSections:(NSArray *)newSections;
+
+#pragma mark Changes
+/** @name Changes */
+
+/**
+ *  The sections to delete, by their old index.
+ */
+@property (nonatomic, strong)   NSMutableIndexSet   *deletedSections;
+
+/**
+ *  The rows to delete, by their old index path.
+ */
+@property (nonatomic, strong)   NSMutableArray      *deletedRows;
+
+/**
+ *  The sections to insert, by their new index.
+ */
+@property (nonatomic, strong)   NSMutableIndexSet   *insertedSections;
+
+/**
+ *  The rows to insert, by their new index path.
+ */
+@property (nonatomic, strong)   NSMutableArray      *insertedRows;
+
+/**
+ *  Indicate if the changes can't be described by insertions, deletions and reloads, so the whole table view must be reloaded.
+ */
+@property (nonatomic, assign)   BOOL                reloadData;
+
+/**
+ *  The sections to reload, by their old index.
+ */
+@property (nonatomic, strong)   NSMutableIndexSet   *reloadedSections;
+
+/**
+ *  The rows to reload, by their old index path.
+ */
+@property (nonatomic, strong)   NSMutableArray      *reloadedRows;
+
+/**
+ *  A deep copy of the sections to display.
+ */
+@property (nonatomic, strong)   NSArray             *sections;
+
+#pragma mark Heights
+/** @name Heights */
+
+/**
+ *  Indicate if all the cached heights must be forgotten.
+ */
+@property (nonatomic, assign)   BOOL                staleHeights;
+
+/**
+ *  The identifiers of the items whose cached height must be forgotten, by identifier of section.
+ */
+@property (nonatomic, strong)   NSMutableDictionary *staleItemsHeights;
+
+/**
+ *  The identifiers of the sections whose cached heights must be forgotten.
+ */
+@property (nonatomic, strong)   NSMutableSet        *staleSectionsHeights;
+
+#pragma mark Compute the changes
+/** @name Compute the changes */
+
+/**
+ *  Add the changes between two versions of a section.
+ *
+ *  @param oldSection The section currently displayed.
+ *  @param oldIndex   The index of the section currently displayed.
+ *  @param newSection The section to display.
+ *  @param newIndex   The index of the section to display.
+ */
+- (void)addChangesFromSection:(MSSPMenuSection *)oldSection atIndex:(NSUInteger)oldIndex toSection:(MSSPMenuSection *)newSection atIndex:(NSUInteger)newIndex;
+
+/**
+ *  Return the index of each object by its identifier.
+ *
+ *  @param objects The objects. They must respond to `identifier`.
+ *
+ *  @return The indexes by identifier. Is `nil` if an identifier is used several times.
+ */
++ (NSDictionary *)indexesByIdentifierOfObjects:(NSArray *)objects;
+
+/**
+ *  Return the number of changes.
+ *
+ *  @return The number of changes.
+ */
+- (NSUInteger)numberOfChanges;
+
+/**
+ *  Forget the cached height of an item.
+ *
+ *  @param itemIdentifier    The item's identifier.
+ *  @param sectionIdentifier The identifier of the item's section.
+ */
+- (void)staleHeightOfItem:(NSString *)itemIdentifier inSection:(NSString *)sectionIdentifier;
+
+@end
+
+#pragma mark - MSSPMenuUpdate implementation
+
+@implementation MSSPMenuUpdate
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return an empty update.
+ *
+ *  @return The update.
+ */
+- (id)init
+{
+    self = [super init];
+    
+    if (self)
+    {
+        [self setDeletedSections:[[NSMutableIndexSet alloc] init]];
+        [self setDeletedRows:[[NSMutableArray alloc] init]];
+        [self setInsertedSections:[[NSMutableIndexSet alloc] init]];
+        [self setInsertedRows:[[NSMutableArray alloc] init]];
+        [self setReloadData:NO];
+        [self setReloadedSections:[[NSMutableIndexSet alloc] init]];
+        [self setReloadedRows:[[NSMutableArray alloc] init]];
+        [self setSections:nil];
+        [self setStaleHeights:NO];
+        [self setStaleItemsHeights:[[NSMutableDictionary alloc] init]];
+        [self setStaleSectionsHeights:[[NSMutableSet alloc] init]];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Compute and return the changes between two versions of a menu.
+ *
+ *  This method doesn't access to UIKit and can be called on any thread.
+ *
+ *  @param oldSections The sections currently displayed.
+ *  @param newSections The sections to display.
+ *
+ *  @return The changes.
+ */
++ (MSSPMenuUpdate *)menuUpdateFromSections:(NSArray *)oldSections toSections:(NSArray *)newSections
+{
+    NSUInteger          i;
+    NSString            *identifier;
+    NSMutableArray      *newCommonIdentifiers;
+    NSDictionary        *newIndexes;
+    MSSPMenuSection     *newSection;
+    NSMutableArray      *oldCommonIdentifiers;
+    NSDictionary        *oldIndexes;
+    MSSPMenuSection     *oldSection;
+    MSSPMenuSection     *section;
+    NSMutableArray      *sections;
+    MSSPMenuUpdate      *update;
+    
+    update = [[MSSPMenuUpdate alloc] init];
+    
+    sections = [[NSMutableArray alloc] initWithCapacity:[newSections count]];
+    for (section in newSections)
+        [sections addObject:[section copy]];
+    [update setSections:sections];
+    
+    oldIndexes = [self indexesByIdentifierOfObjects:oldSections];
+    newIndexes = [self indexesByIdentifierOfObjects:newSections];
+    
+    if (!oldIndexes || !newIndexes)
+    {
+        [update setReloadData:YES];
+        [update setStaleHeights:YES];
+        return (update);
+    }
+    
+    oldCommonIdentifiers = [[NSMutableArray alloc] init];
+    newCommonIdentifiers = [[NSMutableArray alloc] init];
+    
+    for (i = 0; i < [oldSections count]; i++)
+    {
+        identifier = [[oldSections objectAtIndex:i] identifier];
+        
+        if ([newIndexes objectForKey:identifier])
+            [oldCommonIdentifiers addObject:identifier];
+        else
+        {
+            [[update deletedSections] addIndex:i];
+            [[update staleSectionsHeights] addObject:identifier];
+        }
+    }
+    
+    for (i = 0; i < [newSections count]; i++)
+    {
+        identifier = [[newSections objectAtIndex:i] identifier];
+        
+        if ([oldIndexes objectForKey:identifier])
+            [newCommonIdentifiers addObject:identifier];
+        else
+            [[update insertedSections] addIndex:i];
+    }
+    
+    if (![oldCommonIdentifiers isEqualToArray:newCommonIdentifiers])
+    {
+        [update setReloadData:YES];
+        [update setStaleHeights:YES];
+        return (update);
+    }
+    
+    for (identifier in oldCommonIdentifiers)
+    {
+        oldSection = [oldSections objectAtIndex:[[oldIndexes objectForKey:identifier] unsignedIntegerValue]];
+        newSection = [newSections objectAtIndex:[[newIndexes objectForKey:identifier] unsignedIntegerValue]];
+        
+        [update addChangesFromSection:oldSection atIndex:[[oldIndexes objectForKey:identifier] unsignedIntegerValue] toSection:newSection atIndex:[[newIndexes objectForKey:identifier] unsignedIntegerValue]];
+    }
+    
+    if ([update numberOfChanges] > g_menuUpdateMaximumChanges)
+        [update setReloadData:YES];
+    
+    return (update);
+}
+
+#pragma mark Compute the changes
+/** @name Compute the changes */
+
+/**
+ *  Add the changes between two versions of a section.
+ *
+ *  @param oldSection The section currently displayed.
+ *  @param oldIndex   The index of the section currently displayed.
+ *  @param newSection The section to display.
+ *  @param newIndex   The index of the section to display.
+ */
+- (void)addChangesFromSection:(MSSPMenuSection *)oldSection atIndex:(NSUInteger)oldIndex toSection:(MSSPMenuSection *)newSection atIndex:(NSUInteger)newIndex
+{
+    NSUInteger          i;
+    NSString            *identifier;
+    NSMutableArray      *newCommonIdentifiers;
+    NSDictionary        *newIndexes;
+    MSSPMenuItem        *newItem;
+    NSMutableArray      *oldCommonIdentifiers;
+    NSDictionary        *oldIndexes;
+    MSSPMenuItem        *oldItem;
+    
+    if (![[oldSection name] isEqualToString:[newSection name]] || [oldSection selectionRule] != [newSection selectionRule])
+    {
+        [[self reloadedSections] addIndex:oldIndex];
+        [[self staleSectionsHeights] addObject:[oldSection identifier]];
+        return ;
+    }
+    
+    oldIndexes = [[self class] indexesByIdentifierOfObjects:[oldSection items]];
+    newIndexes = [[self class] indexesByIdentifierOfObjects:[newSection items]];
+    
+    if (!oldIndexes || !newIndexes)
+    {
+        [[self reloadedSections] addIndex:oldIndex];
+        [[self staleSectionsHeights] addObject:[oldSection identifier]];
+        return ;
+    }
+    
+    oldCommonIdentifiers = [[NSMutableArray alloc] init];
+    newCommonIdentifiers = [[NSMutableArray alloc] init];
+    
+    for (i = 0; i < [oldSection numberOfItems]; i++)
+    {
+        identifier = [[[oldSection items] objectAtIndex:i] identifier];
+        
+        if ([newIndexes objectForKey:identifier])
+            [oldCommonIdentifiers addObject:identifier];
+        else
+        {
+            [[self deletedRows] addObject:[NSIndexPath indexPathForRow:i inSection:oldIndex]];
+            [self staleHeightOfItem:identifier inSection:[oldSection identifier]];
+        }
+    }
+    
+    for (i = 0; i < [newSection numberOfItems]; i++)
+    {
+        identifier = [[[newSection items] objectAtIndex:i] identifier];
+        
+        if ([oldIndexes objectForKey:identifier])
+            [newCommonIdentifiers addObject:identifier];
+        else
+            [[self insertedRows] addObject:[NSIndexPath indexPathForRow:i inSection:newIndex]];
+    }
+    
+    if (![oldCommonIdentifiers isEqualToArray:newCommonIdentifiers])
+    {
+        [[self deletedRows] filterUsingPredicate:[NSPredicate predicateWithFormat:@"section != %lu", (unsigned long)oldIndex]];
+        [[self insertedRows] filterUsingPredicate:[NSPredicate predicateWithFormat:@"section != %lu", (unsigned long)newIndex]];
+        [[self reloadedSections] addIndex:oldIndex];
+        [[self staleSectionsHeights] addObject:[oldSection identifier]];
+        return ;
+    }
+    
+    for (identifier in oldCommonIdentifiers)
+    {
+        i = [[oldIndexes objectForKey:identifier] unsignedIntegerValue];
+        oldItem = [[oldSection items] objectAtIndex:i];
+        newItem = [[newSection items] objectAtIndex:[[newIndexes objectForKey:identifier] unsignedIntegerValue]];
+        
+        if (![oldItem isDisplayedLikeItem:newItem])
+        {
+            [[self reloadedRows] addObject:[NSIndexPath indexPathForRow:i inSection:oldIndex]];
+            
+            if (![[oldItem name] isEqualToString:[newItem name]])
+                [self staleHeightOfItem:identifier inSection:[oldSection identifier]];
+        }
+    }
+}
+
+/**
+ *  Return the index of each object by its identifier.
+ *
+ *  @param objects The objects. They must respond to `identifier`.
+ *
+ *  @return The indexes by identifier. Is `nil` if an identifier is used several times.
+ */
++ (NSDictionary *)indexesByIdentifierOfObjects:(NSArray *)objects
+{
+    NSUInteger          i;
+    NSString            *identifier;
+    NSMutableDictionary *indexes;
+    
+    indexes = [[NSMutableDictionary alloc] initWithCapacity:[objects count]];
+    
+    for (i = 0; i < [objects count]; i++)
+    {
+        identifier = [[objects objectAtIndex:i] identifier];
+        
+        if ([indexes objectForKey:identifier])
+            return (nil);
+        
+        [indexes setObject:@(i) forKey:identifier];
+    }
+    
+    return (indexes);
+}
+
+/**
+ *  Return the number of changes.
+ *
+ *  @return The number of changes.
+ */
+- (NSUInteger)numberOfChanges
+{
+    return ([[self deletedSections] count] + [[self deletedRows] count] + [[self insertedSections] count] + [[self insertedRows] count] + [[self reloadedSections] count] + [[self reloadedRows] count]);
+}
+
+/**
+ *  Forget the cached height of an item.
+ *
+ *  @param itemIdentifier    The item's identifier.
+ *  @param sectionIdentifier The identifier of the item's section.
+ */
+- (void)staleHeightOfItem:(NSString *)itemIdentifier inSection:(NSString *)sectionIdentifier
+{
+    NSMutableSet    *itemsIdentifiers;
+    
+    itemsIdentifiers = [[self staleItemsHeights] objectForKey:sectionIdentifier];
+    
+    if (!itemsIdentifiers)
+    {
+        itemsIdentifiers = [[NSMutableSet alloc] init];
+        [[self staleItemsHeights] setObject:itemsIdentifiers forKey:sectionIdentifier];
+    }
+    
+    [itemsIdentifiers addObject:itemIdentifier];
+}
+
+@end
+
+#pragma mark - MSSlidingPanelMenuController interface
+
+@interface MSSlidingPanelMenuController () <UITableViewDataSource, UITableViewDelegate>
+
+#pragma mark Menu
+/** @name Menu */
+
+/**
+ *  The sections from which the next changes will be computed. Only accessed on the update queue.
+ */
+@property (nonatomic, strong)   NSArray             *baselineSections;
+
+/**
+ *  The sections currently displayed.
+ */
+@property (nonatomic, strong)   NSArray             *sections;
+
+/**
+ *  Return the section at the index.
+ *
+ *  @param index The index.
+ *
+ *  @return The section. Is `nil` if the index is out of bounds.
+ */
+- (MSSPMenuSection *)sectionAtIndex:(NSInteger)index;
+
+#pragma mark Updates
+/** @name Updates */
+
+/**
+ *  Indicate if the changes must be animated for the pending update.
+ */
+@property (nonatomic, assign)   BOOL                pendingAnimated;
+
+/**
+ *  The completions of the pending update.
+ */
+@property (nonatomic, strong)   NSMutableArray      *pendingCompletions;
+
+/**
+ *  The sections to display once the current update is done.
+ */
+@property (nonatomic, strong)   NSArray             *pendingSections;
+
+/**
+ *  The serial queue on which the changes are computed.
+ */
+@property (nonatomic, strong)   dispatch_queue_t    updateQueue;
+
+/**
+ *  Indicate if an update is in progress.
+ */
+@property (nonatomic, assign)   BOOL                updating;
+
+/**
+ *  Apply an update to the table view.
+ *
+ *  @param update      The update.
+ *  @param animated    YES if the changes must be animated, else NO.
+ *  @param completions The blocks to execute once the update is displayed.
+ */
+- (void)applyMenuUpdate:(MSSPMenuUpdate *)update animated:(BOOL)animated withCompletions:(NSArray *)completions;
+
+/**
+ *  Configure again the visible cells, to display the current state of the items.
+ */
+- (void)refreshVisibleCells;
+
+/**
+ *  Compute the changes for the pending sections, if any.
+ */
+- (void)runPendingUpdate;
+
+#pragma mark Heights
+/** @name Heights */
+
+/**
+ *  The cached heights, by identifier of item, by identifier of section.
+ */
+@property (nonatomic, strong)   NSMutableDictionary *heightCache;
+
+/**
+ *  The width of the table view for which the heights have been cached.
+ */
+@property (nonatomic, assign)   CGFloat             heightCacheWidth;
+
+/**
+ *  Forget the cached heights which have been made stale by an update.
+ *
+ *  @param update The update.
+ */
+- (void)purgeHeightCacheForMenuUpdate:(MSSPMenuUpdate *)update;
+
+@end
+
+#pragma mark - MSSlidingPanelMenuController implementation
+
+@implementation MSSlidingPanelMenuController
+
+#pragma mark Initialization
+/** @name Initialization */
+
+/**
+ *  Create and return a menu controller without sections.
+ *
+ *  @param nibNameOrNil   The nib name or nil.
+ *  @param nibBundleOrNil The bundle name or nil.
+ *
+ *  @return The menu controller.
+ */
+- (id)initWithNibName:(NSString *)nibNameOrNil bundle:(NSBundle *)nibBundleOrNil
+{
+    self = [super initWithNibName:nibNameOrNil bundle:nibBundleOrNil];
+    
+    if (self)
+    {
+        [self setBaselineSections:@[]];
+        [self setSections:@[]];
+        [self setPendingAnimated:NO];
+        [self setPendingCompletions:[[NSMutableArray alloc] init]];
+        [self setPendingSections:nil];
+        [self setUpdateQueue:dispatch_queue_create("MSSlidingPanelMenuController.update", DISPATCH_QUEUE_SERIAL)];
+        [self setUpdating:NO];
+        [self setHeightCache:[[NSMutableDictionary alloc] init]];
+        [self setHeightCacheWidth:0];
+        [self setItemFont:[UIFont systemFontOfSize:18]];
+        [self setMinimumRowHeight:44];
+    }
+    
+    return (self);
+}
+
+/**
+ *  Create and return a menu controller.
+ *
+ *  @param sections An array of `MSSPMenuSection` objects.
+ *
+ *  @return The menu controller.
+ */
+- (id)initWithSections:(NSArray *)sections
+{
+    MSSPMenuUpdate  *update;
+    
+    self = [self initWithNibName:nil bundle:nil];
+    
+    if (self)
+    {
+        update = [MSSPMenuUpdate menuUpdateFromSections:@[] toSections:sections];
+        [self setBaselineSections:[sections copy]];
+        [self setSections:[update sections]];
+    }
+    
+    return (self);
+}
+
+#pragma mark View life cycle
+/** @name View life cycle */
+
+/**
+ *  Creates the view that the controller manages.
+ */
+- (void)loadView
+{
+    UITableView *tableView;
+    CGSize      windowSize;
+    
+    windowSize = [[UIScreen mainScreen] bounds].size;
+    
+    tableView = [[UITableView alloc] initWithFrame:CGRectMake(0, 20, windowSize.width, windowSize.height - 20)];
+    [tableView setDataSource:self];
+    [tableView setDelegate:self];
+    [tableView registerClass:[UITableViewCell class] forCellReuseIdentifier:g_menuCellIdentifier];
+    [tableView setTableFooterView:[[UIView alloc] init]];
+    [tableView setEstimatedRowHeight:[self minimumRowHeight]];
+    [tableView setAutoresizingMask:(UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight)];
+    
+    _tableView = tableView;
+    
+    [self setView:[[UIView alloc] initWithFrame:CGRectMake(0, 0, windowSize.width, windowSize.height)]];
+    [[self view] addSubview:tableView];
+}
+
+#pragma mark Menu
+/** @name Menu */
+
+/**
+ *  Return the section at the index.
+ *
+ *  @param index The index.
+ *
+ *  @return The section. Is `nil` if the index is out of bounds.
+ */
+- (MSSPMenuSection *)sectionAtIndex:(NSInteger)index
+{
+    if ((NSUInteger)index >= [[self sections] count])
+        return (nil);
+    
+    return ([[self sections] objectAtIndex:index]);
+}
+
+/**
+ *  Set the sections to display.
+ *
+ *  The sections are copied. The objects must not be modified while the update is in progress.
+ *
+ *  @param sections An array of `MSSPMenuSection` objects.
+ *  @param animated YES if the changes must be animated, else NO.
+ */
+- (void)setSections:(NSArray *)sections animated:(BOOL)animated
+{
+    [self setSections:sections animated:animated completion:nil];
+}
+
+/**
+ *  Set the sections to display.
+ *
+ *  The sections are copied. The objects must not be modified while the update is in progress.
+ *  If several updates are requested while one is in progress, only the last sections are displayed.
+ *
+ *  @param sections   An array of `MSSPMenuSection` objects.
+ *  @param animated   YES if the changes must be animated, else NO.
+ *  @param completion Executed on the main thread once the sections are displayed. Can be `nil`.
+ */
+- (void)setSections:(NSArray *)sections animated:(BOOL)animated completion:(void (^)(void))completion
+{
+    NSParameterAssert([NSThread isMainThread]);
+    
+    [self setPendingSections:(sections ? [sections copy] : @[])];
+    [self setPendingAnimated:animated];
+    
+    if (completion)
+        [[self pendingCompletions] addObject:[completion copy]];
+    
+    if (![self updating])
+        [self runPendingUpdate];
+}
+
+#pragma mark Updates
+/** @name Updates */
+
+/**
+ *  Apply an update to the table view.
+ *
+ *  @param update      The update.
+ *  @param animated    YES if the changes must be animated, else NO.
+ *  @param completions The blocks to execute once the update is displayed.
+ */
+- (void)applyMenuUpdate:(MSSPMenuUpdate *)update animated:(BOOL)animated withCompletions:(NSArray *)completions
+{
+    UITableViewRowAnimation rowAnimation;
+    void                    (^completion)(void);
+    void                    (^changes)(void);
+    
+    completion = ^(void)
+    {
+        void    (^block)(void);
+        
+        for (block in completions)
+            block();
+    };
+    
+    [self purgeHeightCacheForMenuUpdate:update];
+    
+    if (![self isViewLoaded] || [update reloadData])
+    {
+        [self setSections:[update sections]];
+        
+        if ([self isViewLoaded])
+            [[self tableView] reloadData];
+        
+        completion();
+    }
+    else
+    {
+        rowAnimation = (animated ? UITableViewRowAnimationFade : UITableViewRowAnimationNone);
+        
+        changes = ^(void)
+        {
+            [CATransaction begin];
+            [CATransaction setCompletionBlock:completion];
+            
+            [[self tableView] beginUpdates];
+            [self setSections:[update sections]];
+            [[self tableView] deleteSections:[update deletedSections] withRowAnimation:rowAnimation];
+            [[self tableView] insertSections:[update insertedSections] withRowAnimation:rowAnimation];
+            [[self tableView] reloadSections:[update reloadedSections] withRowAnimation:rowAnimation];
+            [[self tableView] deleteRowsAtIndexPaths:[update deletedRows] withRowAnimation:rowAnimation];
+            [[self tableView] insertRowsAtIndexPaths:[update insertedRows] withRowAnimation:rowAnimation];
+            [[self tableView] reloadRowsAtIndexPaths:[update reloadedRows] withRowAnimation:rowAnimation];
+            [[self tableView] endUpdates];
+            
+            [CATransaction commit];
+        };
+        
+        if (animated)
+            changes();
+        else
+            [UIView performWithoutAnimation:changes];
+        
+        [self refreshVisibleCells];
+    }
+    
+    [self setUpdating:NO];
+    [self runPendingUpdate];
+}
+
+/**
+ *  Configure again the visible cells, to display the current state of the items.
+ */
+- (void)refreshVisibleCells
+{
+    NSIndexPath     *indexPath;
+    MSSPMenuSection *section;
+    
+    for (indexPath in [[self tableView] indexPathsForVisibleRows])
+    {
+        section = [self sectionAtIndex:[indexPath section]];
+        [self configureCell:[[self tableView] cellForRowAtIndexPath:indexPath] forItem:[[section items] objectAtIndex:[indexPath row]] inSection:section];
+    }
+}
+
+/**
+ *  Compute the changes for the pending sections, if any.
+ */
+- (void)runPendingUpdate
+{
+    BOOL    animated;
+    NSArray *completions;
+    NSArray *sections;
+    
+    if (![self pendingSections])
+        return ;
+    
+    animated = [self pendingAnimated];
+    completions = [self pendingCompletions];
+    sections = [self pendingSections];
+    
+    [self setPendingCompletions:[[NSMutableArray alloc] init]];
+    [self setPendingSections:nil];
+    [self setUpdating:YES];
+    
+    dispatch_async([self updateQueue], ^(void)
+    {
+        MSSPMenuUpdate  *update;
+        
+        update = [MSSPMenuUpdate menuUpdateFromSections:[self baselineSections] toSections:sections];
+        [self setBaselineSections:sections];
+        
+        dispatch_async(dispatch_get_main_queue(), ^(void)
+        {
+            [self applyMenuUpdate:update animated:animated withCompletions:completions];
+        });
+    });
+}
+
+#pragma mark Appearance
+/** @name Appearance */
+
+/**
+ *  Set the font used to display the items' name.
+ *
+ *  @param itemFont The font.
+ */
+- (void)setItemFont:(UIFont *)itemFont
+{
+    _itemFont = itemFont;
+    
+    [[self heightCache] removeAllObjects];
+    
+    if ([self isViewLoaded])
+        [[self tableView] reloadData];
+}
+
+/**
+ *  Set the minimum height of a row.
+ *
+ *  @param minimumRowHeight The height.
+ */
+- (void)setMinimumRowHeight:(CGFloat)minimumRowHeight
+{
+    _minimumRowHeight = minimumRowHeight;
+    
+    [[self heightCache] removeAllObjects];
+    
+    if ([self isViewLoaded])
+    {
+        [[self tableView] setEstimatedRowHeight:minimumRowHeight];
+        [[self tableView] reloadData];
+    }
+}
+
+#pragma mark Customize the cells
+/** @name Customize the cells */
+
+/**
+ *  Configure a cell to display an item.
+ *
+ *  @param cell    The cell.
+ *  @param item    The item.
+ *  @param section The section of the item.
+ */
+- (void)configureCell:(UITableViewCell *)cell forItem:(MSSPMenuItem *)item inSection:(MSSPMenuSection *)section
+{
+    [[cell textLabel] setText:[item name]];
+    [[cell textLabel] setFont:[self itemFont]];
+    [[cell textLabel] setNumberOfLines:0];
+    
+    if ([section selectionRule] == MSSPMenuSelectionRuleNone)
+        [cell setAccessoryType:UITableViewCellAccessoryDisclosureIndicator];
+    else if ([item checked])
+        [cell setAccessoryType:UITableViewCellAccessoryCheckmark];
+    else
+        [cell setAccessoryType:UITableViewCellAccessoryNone];
+}
+
+/**
+ *  Compute the height of the row displaying an item.
+ *
+ *  @param item    The item.
+ *  @param section The section of the item.
+ *  @param width   The width of the table view.
+ *
+ *  @return The height.
+ */
+- (CGFloat)heightForItem:(MSSPMenuItem *)item inSection:(MSSPMenuSection *)__unused section withWidth:(CGFloat)width
+{
+    CGRect  textRect;
+    CGFloat textWidth;
+    
+    textWidth = MAX(width - 2 * g_menuCellHorizontalMargin - g_menuCellAccessoryWidth, 0);
+    textRect = [[item name] boundingRectWithSize:CGSizeMake(textWidth, CGFLOAT_MAX) options:NSStringDrawingUsesLineFragmentOrigin attributes:@{NSFontAttributeName: [self itemFont]} context:nil];
+    
+    return (MAX([self minimumRowHeight], ceil(textRect.size.height) + 2 * g_menuCellVerticalMargin));
+}
+
+#pragma mark Heights
+/** @name Heights */
+
+/**
+ *  Forget the cached heights which have been made stale by an update.
+ *
+ *  @param update The update.
+ */
+- (void)purgeHeightCacheForMenuUpdate:(MSSPMenuUpdate *)update
+{
+    NSString    *sectionIdentifier;
+    
+    if ([update staleHeights])
+    {
+        [[self heightCache] removeAllObjects];
+        return ;
+    }
+    
+    for (sectionIdentifier in [update staleSectionsHeights])
+        [[self heightCache] removeObjectForKey:sectionIdentifier];
+    
+    for (sectionIdentifier in [update staleItemsHeights])
+        [[[self heightCache] objectForKey:sectionIdentifier] removeObjectsForKeys:[[[update staleItemsHeights] objectForKey:sectionIdentifier] allObjects]];
+}
+
+#pragma mark UITableViewDataSource protocol
+/** @name UITableViewDataSource protocol */
+
+/**
+ *  Give the number of sections in a table view.
+ *
+ *  @param tableView The table view.
+ *
+ *  @return The number of values.
+ */
+- (NSInteger)numberOfSectionsInTableView:(UITableView *)__unused tableView
+{
+    return ([[self sections] count]);
+}
+
+/**
+ *  Return the cell for the index path in the table view.
+ *
+ *  @param tableView The table view.
+ *  @param indexPath The index path.
+ *
+ *  @return The cell.
+ */
+- (UITableViewCell *)tableView:(UITableView *)tableView cellForRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    UITableViewCell *cell;
+    MSSPMenuSection *section;
+    
+    cell = [tableView dequeueReusableCellWithIdentifier:g_menuCellIdentifier forIndexPath:indexPath];
+    section = [self sectionAtIndex:[indexPath section]];
+    
+    [self configureCell:cell forItem:[[section items] objectAtIndex:[indexPath row]] inSection:section];
+    
+    return (cell);
+}
+
+/**
+ *  Return the number of rows in a section of a table view.
+ *
+ *  @param tableView The table view.
+ *  @param section   The section number.
+ *
+ *  @return The number of rows.
+ */
+- (NSInteger)tableView:(UITableView *)__unused tableView numberOfRowsInSection:(NSInteger)section
+{
+    return ([[self sectionAtIndex:section] numberOfItems]);
+}
+
+/**
+ *  Return the title of the header of a section.
+ *
+ *  @param tableView The table view.
+ *  @param section   The section number.
+ *
+ *  @return The title.
+ */
+- (NSString *)tableView:(UITableView *)__unused tableView titleForHeaderInSection:(NSInteger)section
+{
+    return ([[self sectionAtIndex:section] name]);
+}
+
+#pragma mark UITableViewDelegate protocol
+/** @name UITableViewDelegate protocol */
+
+/**
+ *  Return the height of a row. The heights are cached by identifier of item until the item's name or the table view's width changes.
+ *
+ *  @param tableView The table view.
+ *  @param indexPath The row's index path.
+ *
+ *  @return The height.
+ */
+- (CGFloat)tableView:(UITableView *)tableView heightForRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    NSNumber            *height;
+    MSSPMenuItem        *item;
+    MSSPMenuSection     *section;
+    NSMutableDictionary *sectionHeights;
+    
+    if ([tableView bounds].size.width != [self heightCacheWidth])
+    {
+        [[self heightCache] removeAllObjects];
+        [self setHeightCacheWidth:[tableView bounds].size.width];
+    }
+    
+    section = [self sectionAtIndex:[indexPath section]];
+    item = [[section items] objectAtIndex:[indexPath row]];
+    sectionHeights = [[self heightCache] objectForKey:[section identifier]];
+    
+    if (!sectionHeights)
+    {
+        sectionHeights = [[NSMutableDictionary alloc] init];
+        [[self heightCache] setObject:sectionHeights forKey:[section identifier]];
+    }
+    
+    height = [sectionHeights objectForKey:[item identifier]];
+    
+    if (!height)
+    {
+        height = @([self heightForItem:item inSection:section withWidth:[self heightCacheWidth]]);
+        [sectionHeights setObject:height forKey:[item identifier]];
+    }
+    
+    return ([height doubleValue]);
+}
+
+/**
+ *  Called when a cell will be selected.
+ *
+ *  @param tableView The table view.
+ *  @param indexPath The cell's index path.
+ *
+ *  @return The indexpath of the cell which must be selected.
+ */
+- (NSIndexPath *)tableView:(UITableView *)tableView willSelectRowAtIndexPath:(NSIndexPath *)indexPath
+{
+    NSIndexPath     *previousIndexPath;
+    MSSPMenuSection *section;
+    
+    section = [self sectionAtIndex:[indexPath section]];
+    previousIndexPath = [NSIndexPath indexPathForRow:[section itemSelectedIndex] inSection:[indexPath section]];
+    
+    [section selectItemAtIndex:[indexPath row]];
+    
+    if ([section selectionRule] == MSSPMenuSelectionRuleOnlyOne)
+        [self configureCell:[tableView cellForRowAtIndexPath:previousIndexPath] forItem:[[section items] objectAtIndex:[previousIndexPath row]] inSection:section];
+    
+    if ([section selectionRule] != MSSPMenuSelectionRuleNone)
+        [self configureCell:[tableView cellForRowAtIndexPath:indexPath] forItem:[[section items] objectAtIndex:[indexPath row]] inSection:section];
+    
+    return (nil);
+}
+
+@end
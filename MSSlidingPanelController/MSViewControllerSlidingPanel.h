@@ -46,4 +46,14 @@
  */
 @property (nonatomic, strong, readonly) MSSlidingPanelController    *slidingPanelController;
 
+#pragma mark Getting the panel visibility
+/** @name Getting the panel visibility */
+
+/**
+ *  Indicate if the receiver is in a panel which is hidden.
+ *
+ *  This property is YES when the receiver or one of its ancestors is the left or right panel of a sliding controller and this panel is hidden. Panels can read it to pause their timers, queries and animations. This property is NO if the view controller is not embedded inside a panel.
+ */
+@property (nonatomic, assign, readonly, getter = isSlidingPanelHidden) BOOL slidingPanelHidden;
+
 @end
@@ -55,4 +55,34 @@
     return (nil);
 }
 
+#pragma mark Getting the panel visibility
+/** @name Getting the panel visibility */
+
+/**
+ *  Indicate if the receiver is in a panel which is hidden.
+ *
+ *  This property is YES when the receiver or one of its ancestors is the left or right panel of a sliding controller and this panel is hidden. Panels can read it to pause their timers, queries and animations. This property is NO if the view controller is not embedded inside a panel.
+ */
+- (BOOL)isSlidingPanelHidden
+{
+    UIViewController            *panelController;
+    MSSlidingPanelController    *slidingPanelController;
+    
+    panelController = self;
+    slidingPanelController = [self slidingPanelController];
+    
+    while (panelController && [panelController parentViewController] != slidingPanelController)
+        panelController = [panelController parentViewController];
+    
+    if (!slidingPanelController || !panelController)
+        return (NO);
+    
+    if (panelController == [slidingPanelController leftPanelController])
+        return ([slidingPanelController isPanelHiddenForSide:MSSPSideDisplayedLeft]);
+    else if (panelController == [slidingPanelController rightPanelController])
+        return ([slidingPanelController isPanelHiddenForSide:MSSPSideDisplayedRight]);
+    
+    return (NO);
+}
+
 @end